@@ -0,0 +1,192 @@
+#include "Benchmarks/Cases/cases.hpp"
+#include "Benchmarks/Harness/State.ipp"
+#include "Benchmarks/Harness/random.ipp"
+#include "Foundation/Algorithms/sort.ipp"
+#include "Foundation/concepts.hpp"
+#include "Foundation/containers.hpp"
+#include "Foundation/types.hpp"
+#include "Foundation/utilities.hpp"
+
+#include <algorithm>
+#include <string>
+
+#if defined(FN_BENCHMARKS_PARALLEL_STL)
+  #include <execution>
+#endif
+
+namespace fn::Benchmarks::Cases
+{
+  namespace
+  {
+    constexpr size VALUE_COUNT{262'144};
+
+    /**
+     * @brief The element counts of the scaling cases and whether they are only run on request.
+     */
+    constexpr arr<pair<size, bln>, 3> SCALING_COUNTS{
+      {{1'000'000, false}, {100'000'000, true}, {1'000'000'000, true}}
+    };
+
+    struct Record
+    {
+      u64 key;
+      u64 payload;
+    };
+
+    enum class Sorter : u8
+    {
+      STD_SORT,
+      STD_SORT_PARALLEL,
+      STD_STABLE_SORT,
+      FN_SEQUENTIAL,
+      FN_PARALLEL
+    };
+
+    template <typename T>
+    auto makeValues(const size count) -> vec<T>
+    {
+      if constexpr (IsSameAs<T, Record>)
+      {
+        const auto keys{Harness::makeRandom<u64>(count)};
+        vec<Record> records(count);
+        for (size index{0}; index < count; ++index)
+        {
+          records[index] = Record{.key = keys[index], .payload = index};
+        }
+        return records;
+      }
+      else if constexpr (IsIntegral<T>)
+      {
+        return Harness::makeRandom<T>(count);
+      }
+      else
+      {
+        return Harness::makeRandom<T>(count, T{-1e9}, T{1e9});
+      }
+    }
+
+    template <typename T, Sorter sorter>
+    auto sortValues(Harness::State& state, const size count) -> none
+    {
+      constexpr auto KEY_OF{[](const Record& record) -> u64
+                            {
+                              return record.key;
+                            }};
+      constexpr auto EXECUTION{
+        sorter == Sorter::FN_PARALLEL ? Algorithms::Execution::PARALLEL
+                                      : Algorithms::Execution::SEQUENTIAL
+      };
+
+      const auto input{makeValues<T>(count)};
+      vec<T>     values;
+      state.setItemCount(count);
+      for ([[maybe_unused]] const size iteration : state)
+      {
+        // Restore the unsorted input outside of the measurement
+        state.pauseTiming();
+        values = input;
+        state.resumeTiming();
+
+        // Sort the values
+        if constexpr (IsSameAs<T, Record> and sorter == Sorter::STD_SORT)
+        {
+          std::ranges::sort(values, std::ranges::less{}, &Record::key);
+        }
+#if defined(FN_BENCHMARKS_PARALLEL_STL)
+        else if constexpr (IsSameAs<T, Record> and sorter == Sorter::STD_SORT_PARALLEL)
+        {
+          std::sort(
+            std::execution::par,
+            values.begin(),
+            values.end(),
+            [](const Record& left, const Record& right) -> bln
+            {
+              return left.key < right.key;
+            }
+          );
+        }
+#endif
+        else if constexpr (IsSameAs<T, Record> and sorter == Sorter::STD_STABLE_SORT)
+        {
+          std::ranges::stable_sort(values, std::ranges::less{}, &Record::key);
+        }
+        else if constexpr (IsSameAs<T, Record>)
+        {
+          Algorithms::sort(values, KEY_OF, EXECUTION);
+        }
+        else if constexpr (sorter == Sorter::STD_SORT)
+        {
+          std::ranges::sort(values);
+        }
+#if defined(FN_BENCHMARKS_PARALLEL_STL)
+        else if constexpr (sorter == Sorter::STD_SORT_PARALLEL)
+        {
+          std::sort(std::execution::par, values.begin(), values.end());
+        }
+#endif
+        else if constexpr (sorter == Sorter::STD_STABLE_SORT)
+        {
+          std::ranges::stable_sort(values);
+        }
+        else
+        {
+          Algorithms::sort(values, EXECUTION);
+        }
+        Harness::doNotOptimize(values.data());
+        Harness::clobberMemory();
+      }
+    }
+
+    template <typename T, Sorter sorter>
+    auto add(Harness::Registry& registry, const str& name, const size count) -> none
+    {
+      registry.add(
+        name,
+        [count](Harness::State& state) -> none
+        {
+          sortValues<T, sorter>(state, count);
+        }
+      );
+    }
+
+    template <typename T>
+    auto add(Harness::Registry& registry, const str& prefix, const size count) -> none
+    {
+      add<T, Sorter::STD_SORT>(registry, prefix + "/std_sort", count);
+#if defined(FN_BENCHMARKS_PARALLEL_STL)
+      add<T, Sorter::STD_SORT_PARALLEL>(registry, prefix + "/std_sort_par", count);
+#endif
+      add<T, Sorter::STD_STABLE_SORT>(registry, prefix + "/std_stable_sort", count);
+      add<T, Sorter::FN_SEQUENTIAL>(registry, prefix + "/fn_sequential", count);
+      add<T, Sorter::FN_PARALLEL>(registry, prefix + "/fn_parallel", count);
+    }
+
+    template <typename T>
+    auto addScaling(Harness::Registry& registry, const strv type, const bln isLarge) -> none
+    {
+      for (const auto& [count, isOnRequest] : SCALING_COUNTS)
+      {
+        if (isOnRequest and not isLarge)
+        {
+          continue;
+        }
+        const str label{
+          count % 1'000'000'000 == 0 ? std::to_string(count / 1'000'000'000) + 'B'
+                                     : std::to_string(count / 1'000'000) + 'M'
+        };
+        const str prefix{str{"algorithms/sort_scaling/"} + str{type} + '/' + label};
+        add<T>(registry, prefix, count);
+      }
+    }
+  } // namespace
+
+  auto registerAlgorithms(Harness::Registry& registry, const bln isLarge) -> none
+  {
+    add<u32>(registry, "algorithms/sort/u32", VALUE_COUNT);
+    add<i64>(registry, "algorithms/sort/i64", VALUE_COUNT);
+    add<f64>(registry, "algorithms/sort/f64", VALUE_COUNT);
+    add<Record>(registry, "algorithms/sort/record", VALUE_COUNT);
+    addScaling<u64>(registry, "u64", isLarge);
+    addScaling<f64>(registry, "f64", isLarge);
+  }
+} // namespace fn::Benchmarks::Cases
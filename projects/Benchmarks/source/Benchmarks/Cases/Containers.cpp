@@ -0,0 +1,153 @@
+#include "Benchmarks/Cases/cases.hpp"
+#include "Benchmarks/Harness/State.ipp"
+#include "Benchmarks/Harness/random.ipp"
+#include "Foundation/containers.hpp"
+#include "Foundation/types.hpp"
+
+namespace fn::Benchmarks::Cases
+{
+  namespace
+  {
+    constexpr size KEY_COUNT{4'096};
+
+    template <typename TContainer>
+    auto pushBack(Harness::State& state) -> none
+    {
+      const auto keys{Harness::makeRandom<u64>(KEY_COUNT)};
+      state.setItemCount(KEY_COUNT);
+      for ([[maybe_unused]] const size iteration : state)
+      {
+        TContainer container;
+        for (const auto key : keys)
+        {
+          container.push_back(key);
+        }
+        Harness::doNotOptimize(container);
+      }
+    }
+
+    auto vecPushBackReserved(Harness::State& state) -> none
+    {
+      const auto keys{Harness::makeRandom<u64>(KEY_COUNT)};
+      state.setItemCount(KEY_COUNT);
+      for ([[maybe_unused]] const size iteration : state)
+      {
+        vec<u64> container;
+        container.reserve(KEY_COUNT);
+        for (const auto key : keys)
+        {
+          container.push_back(key);
+        }
+        Harness::doNotOptimize(container);
+      }
+    }
+
+    auto sllPushFront(Harness::State& state) -> none
+    {
+      const auto keys{Harness::makeRandom<u64>(KEY_COUNT)};
+      state.setItemCount(KEY_COUNT);
+      for ([[maybe_unused]] const size iteration : state)
+      {
+        sll<u64> container;
+        for (const auto key : keys)
+        {
+          container.push_front(key);
+        }
+        Harness::doNotOptimize(container);
+      }
+    }
+
+    template <typename TContainer>
+    auto insert(Harness::State& state) -> none
+    {
+      const auto keys{Harness::makeRandom<u64>(KEY_COUNT)};
+      state.setItemCount(KEY_COUNT);
+      for ([[maybe_unused]] const size iteration : state)
+      {
+        TContainer container;
+        for (const auto key : keys)
+        {
+          if constexpr (requires { typename TContainer::mapped_type; })
+          {
+            container.emplace(key, key);
+          }
+          else
+          {
+            container.insert(key);
+          }
+        }
+        Harness::doNotOptimize(container);
+      }
+    }
+
+    template <typename TContainer>
+    auto find(Harness::State& state) -> none
+    {
+      const auto keys{Harness::makeRandom<u64>(KEY_COUNT)};
+      TContainer container;
+      for (const auto key : keys)
+      {
+        container.emplace(key, key);
+      }
+      state.setItemCount(KEY_COUNT);
+      for ([[maybe_unused]] const size iteration : state)
+      {
+        for (const auto key : keys)
+        {
+          Harness::doNotOptimize(container.find(key));
+        }
+      }
+    }
+
+    auto pquePushPop(Harness::State& state) -> none
+    {
+      const auto keys{Harness::makeRandom<u64>(KEY_COUNT)};
+      state.setItemCount(KEY_COUNT);
+      for ([[maybe_unused]] const size iteration : state)
+      {
+        pque<u64> queue;
+        for (const auto key : keys)
+        {
+          queue.push(key);
+        }
+        while (not queue.empty())
+        {
+          Harness::doNotOptimize(queue.top());
+          queue.pop();
+        }
+      }
+    }
+
+    auto strAppend(Harness::State& state) -> none
+    {
+      const auto characters{Harness::makeRandom<cdef>(KEY_COUNT, 'a', 'z')};
+      state.setItemCount(KEY_COUNT);
+      for ([[maybe_unused]] const size iteration : state)
+      {
+        str text;
+        for (const auto character : characters)
+        {
+          text += character;
+        }
+        Harness::doNotOptimize(text);
+      }
+    }
+  } // namespace
+
+  auto registerContainers(Harness::Registry& registry) -> none
+  {
+    registry.add("containers/vec/push_back", pushBack<vec<u64>>)
+      .add("containers/vec/push_back_reserved", vecPushBackReserved)
+      .add("containers/bque/push_back", pushBack<bque<u64>>)
+      .add("containers/dll/push_back", pushBack<dll<u64>>)
+      .add("containers/sll/push_front", sllPushFront)
+      .add("containers/str/append", strAppend)
+      .add("containers/set/insert", insert<set<u64>>)
+      .add("containers/uset/insert", insert<uset<u64>>)
+      .add("containers/map/insert", insert<map<u64, u64>>)
+      .add("containers/umap/insert", insert<umap<u64, u64>>)
+      .add("containers/map/find", find<map<u64, u64>>)
+      .add("containers/umap/find", find<umap<u64, u64>>)
+      .add("containers/pque/push_pop", pquePushPop);
+  }
+} // namespace fn::Benchmarks::Cases
@@ -0,0 +1,116 @@
+#include "Benchmarks/Cases/cases.hpp"
+#include "Benchmarks/Harness/State.ipp"
+#include "Foundation/Coroutine/Generator.ipp"
+#include "Foundation/Coroutine/Task.ipp"
+#include "Foundation/types.hpp"
+
+namespace fn::Benchmarks::Cases
+{
+  namespace
+  {
+    constexpr size CHAIN_DEPTH{8};
+    constexpr i64  SEQUENCE_LENGTH{1'024};
+
+    [[gnu::noinline]] auto callChain(const size depth, const i64 value) -> i64
+    {
+      if (depth == 0)
+      {
+        return value;
+      }
+      return callChain(depth - 1, value) + 1;
+    }
+
+    auto taskChain(const size depth, const i64 value) -> task<i64>
+    {
+      // Keep `co_await` out of the conditional operator, which GCC 12 miscompiles
+      if (depth == 0)
+      {
+        co_return value;
+      }
+      co_return co_await taskChain(depth - 1, value) + 1;
+    }
+
+    auto sequence(const i64 length) -> generator<i64>
+    {
+      for (i64 value{0}; value < length; ++value)
+      {
+        co_yield value;
+      }
+    }
+  } // namespace
+
+  auto registerCoroutine(Harness::Registry& registry) -> none
+  {
+    registry
+      .add(
+        "coroutine/call/baseline",
+        [](Harness::State& state) -> none
+        {
+          for (const size iteration : state)
+          {
+            Harness::doNotOptimize(callChain(0, static_cast<i64>(iteration)));
+          }
+        }
+      )
+      .add(
+        "coroutine/task/sync_wait",
+        [](Harness::State& state) -> none
+        {
+          for (const size iteration : state)
+          {
+            Harness::doNotOptimize(syncWait(taskChain(0, static_cast<i64>(iteration))));
+          }
+        }
+      )
+      .add(
+        "coroutine/call_chain/baseline",
+        [](Harness::State& state) -> none
+        {
+          state.setItemCount(CHAIN_DEPTH);
+          for (const size iteration : state)
+          {
+            Harness::doNotOptimize(callChain(CHAIN_DEPTH, static_cast<i64>(iteration)));
+          }
+        }
+      )
+      .add(
+        "coroutine/task_chain/co_await",
+        [](Harness::State& state) -> none
+        {
+          state.setItemCount(CHAIN_DEPTH);
+          for (const size iteration : state)
+          {
+            Harness::doNotOptimize(syncWait(taskChain(CHAIN_DEPTH, static_cast<i64>(iteration))));
+          }
+        }
+      )
+      .add(
+        "coroutine/sequence/loop",
+        [](Harness::State& state) -> none
+        {
+          state.setItemCount(SEQUENCE_LENGTH);
+          for ([[maybe_unused]] const size iteration : state)
+          {
+            for (i64 value{0}; value < SEQUENCE_LENGTH; ++value)
+            {
+              Harness::doNotOptimize(value);
+            }
+          }
+        }
+      )
+      .add(
+        "coroutine/sequence/generator",
+        [](Harness::State& state) -> none
+        {
+          state.setItemCount(SEQUENCE_LENGTH);
+          for ([[maybe_unused]] const size iteration : state)
+          {
+            for (const auto value : sequence(SEQUENCE_LENGTH))
+            {
+              Harness::doNotOptimize(value);
+            }
+          }
+        }
+      );
+  }
+} // namespace fn::Benchmarks::Cases
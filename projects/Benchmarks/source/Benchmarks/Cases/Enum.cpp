@@ -0,0 +1,223 @@
+#include "Benchmarks/Cases/cases.hpp"
+#include "Benchmarks/Harness/State.ipp"
+#include "Benchmarks/Harness/random.ipp"
+#include "Foundation/Enum/name.ipp"
+#include "Foundation/Enum/parse.ipp"
+#include "Foundation/containers.hpp"
+#include "Foundation/types.hpp"
+
+namespace fn::Benchmarks::Cases
+{
+  namespace
+  {
+    constexpr size QUERY_COUNT{1'024};
+
+    enum class Color : u8
+    {
+      RED,
+      ORANGE,
+      YELLOW,
+      LIME,
+      GREEN,
+      TEAL,
+      CYAN,
+      AZURE,
+      BLUE,
+      VIOLET,
+      PURPLE,
+      MAGENTA,
+      PINK,
+      BROWN,
+      GRAY,
+      BLACK
+    };
+
+    constexpr arr<strv, 16> NAMES{
+      "RED",
+      "ORANGE",
+      "YELLOW",
+      "LIME",
+      "GREEN",
+      "TEAL",
+      "CYAN",
+      "AZURE",
+      "BLUE",
+      "VIOLET",
+      "PURPLE",
+      "MAGENTA",
+      "PINK",
+      "BROWN",
+      "GRAY",
+      "BLACK"
+    };
+
+    [[nodiscard]] auto nameBySwitch(const Color color) -> strv
+    {
+      switch (color)
+      {
+        case Color::RED:
+          return "RED";
+        case Color::ORANGE:
+          return "ORANGE";
+        case Color::YELLOW:
+          return "YELLOW";
+        case Color::LIME:
+          return "LIME";
+        case Color::GREEN:
+          return "GREEN";
+        case Color::TEAL:
+          return "TEAL";
+        case Color::CYAN:
+          return "CYAN";
+        case Color::AZURE:
+          return "AZURE";
+        case Color::BLUE:
+          return "BLUE";
+        case Color::VIOLET:
+          return "VIOLET";
+        case Color::PURPLE:
+          return "PURPLE";
+        case Color::MAGENTA:
+          return "MAGENTA";
+        case Color::PINK:
+          return "PINK";
+        case Color::BROWN:
+          return "BROWN";
+        case Color::GRAY:
+          return "GRAY";
+        case Color::BLACK:
+          return "BLACK";
+      }
+      return {};
+    }
+
+    [[nodiscard]] auto parseByScan(const strv text) -> Color
+    {
+      for (size index{0}; index < NAMES.size(); ++index)
+      {
+        if (NAMES[index] == text)
+        {
+          return static_cast<Color>(index);
+        }
+      }
+      return {};
+    }
+
+    auto makeColors() -> vec<Color>
+    {
+      vec<Color> colors;
+      for (const auto value : Harness::makeRandom<u8>(QUERY_COUNT, 0, NAMES.size() - 1))
+      {
+        colors.push_back(static_cast<Color>(value));
+      }
+      return colors;
+    }
+
+    auto makeNames() -> vec<strv>
+    {
+      vec<strv> names;
+      for (const auto color : makeColors())
+      {
+        names.push_back(NAMES[static_cast<size>(color)]);
+      }
+      return names;
+    }
+
+    template <typename TName>
+    auto nameColors(Harness::State& state, const TName& name) -> none
+    {
+      const auto colors{makeColors()};
+      state.setItemCount(QUERY_COUNT);
+      for ([[maybe_unused]] const size iteration : state)
+      {
+        for (const auto color : colors)
+        {
+          Harness::doNotOptimize(name(color));
+        }
+      }
+    }
+
+    template <typename TParse>
+    auto parseNames(Harness::State& state, const TParse& parse) -> none
+    {
+      const auto names{makeNames()};
+      state.setItemCount(QUERY_COUNT);
+      for ([[maybe_unused]] const size iteration : state)
+      {
+        for (const auto name : names)
+        {
+          Harness::doNotOptimize(parse(name));
+        }
+      }
+    }
+  } // namespace
+
+  auto registerEnum(Harness::Registry& registry) -> none
+  {
+    registry
+      .add(
+        "enum/name/switch",
+        [](Harness::State& state) -> none
+        {
+          nameColors(state, nameBySwitch);
+        }
+      )
+      .add(
+        "enum/name/umap",
+        [](Harness::State& state) -> none
+        {
+          umap<Color, strv> names;
+          for (size index{0}; index < NAMES.size(); ++index)
+          {
+            names.emplace(static_cast<Color>(index), NAMES[index]);
+          }
+          nameColors(
+            state,
+            [&names](const Color color) -> strv
+            {
+              return names.find(color)->second;
+            }
+          );
+        }
+      )
+      .add(
+        "enum/name/fn",
+        [](Harness::State& state) -> none
+        {
+          nameColors(state, Enum::name<Color>);
+        }
+      )
+      .add(
+        "enum/parse/linear_scan",
+        [](Harness::State& state) -> none
+        {
+          parseNames(state, parseByScan);
+        }
+      )
+      .add(
+        "enum/parse/umap",
+        [](Harness::State& state) -> none
+        {
+          umap<strv, Color> colors;
+          for (size index{0}; index < NAMES.size(); ++index)
+          {
+            colors.emplace(NAMES[index], static_cast<Color>(index));
+          }
+          parseNames(
+            state,
+            [&colors](const strv name) -> Color
+            {
+              return colors.find(name)->second;
+            }
+          );
+        }
+      )
+      .add(
+        "enum/parse/fn",
+        [](Harness::State& state) -> none
+        {
+          parseNames(state, Enum::parse<Color>);
+        }
+      );
+  }
+} // namespace fn::Benchmarks::Cases
@@ -0,0 +1,80 @@
+#include "Benchmarks/Cases/cases.hpp"
+#include "Benchmarks/Harness/State.ipp"
+#include "Foundation/errors.hpp"
+#include "Foundation/types.hpp"
+
+#include <stdexcept>
+
+namespace fn::Benchmarks::Cases
+{
+  namespace
+  {
+    using TracedError = _internal::Exception::
+      Exception<_internal::Exception::Name{"TracedError"}, str>;
+  } // namespace
+} // namespace fn::Benchmarks::Cases
+
+// Capture stack traces for this exception only, so that both modes are measured side by side
+template <>
+struct fn::StackTraceCapture<fn::Benchmarks::Cases::TracedError>
+{
+  static constexpr fn::bln IS_ENABLED{true};
+};
+
+namespace fn::Benchmarks::Cases
+{
+  namespace
+  {
+    constexpr size DEEP_DEPTH{16};
+
+    template <typename TError>
+    [[gnu::noinline]] auto throwAt(const size depth) -> none
+    {
+      // Unwind through the frames of the recursion
+      if (depth != 0)
+      {
+        throwAt<TError>(depth - 1);
+        Harness::clobberMemory();
+        return;
+      }
+
+      // Throw the error at the bottom
+      if constexpr (IsSameAs<TError, std::runtime_error>)
+      {
+        throw std::runtime_error{"Benchmark failure!"};
+      }
+      else
+      {
+        throw TError{"Benchmark failure!"};
+      }
+    }
+
+    template <typename TError, size depth>
+    auto throwCatch(Harness::State& state) -> none
+    {
+      for ([[maybe_unused]] const size iteration : state)
+      {
+        try
+        {
+          throwAt<TError>(depth);
+        }
+        catch (const TError& error)
+        {
+          Harness::doNotOptimize(error);
+        }
+      }
+    }
+  } // namespace
+
+  auto registerExceptions(Harness::Registry& registry) -> none
+  {
+    registry.add("exceptions/throw_catch/std_runtime_error", throwCatch<std::runtime_error, 0>)
+      .add("exceptions/throw_catch/fn_untraced", throwCatch<StateError, 0>)
+      .add("exceptions/throw_catch/fn_traced", throwCatch<TracedError, 0>)
+      .add(
+        "exceptions/throw_catch_deep/std_runtime_error", throwCatch<std::runtime_error, DEEP_DEPTH>
+      )
+      .add("exceptions/throw_catch_deep/fn_untraced", throwCatch<StateError, DEEP_DEPTH>)
+      .add("exceptions/throw_catch_deep/fn_traced", throwCatch<TracedError, DEEP_DEPTH>);
+  }
+} // namespace fn::Benchmarks::Cases
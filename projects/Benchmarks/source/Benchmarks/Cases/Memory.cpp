@@ -0,0 +1,93 @@
+#include "Benchmarks/Cases/cases.hpp"
+#include "Benchmarks/Harness/State.ipp"
+#include "Benchmarks/Harness/random.ipp"
+#include "Foundation/Memory/AllocationRegistry.ipp"
+#include "Foundation/Memory/TrackingAllocator.ipp"
+#include "Foundation/containers.hpp"
+#include "Foundation/types.hpp"
+#include "Foundation/utilities.hpp"
+
+#include <functional>
+#include <memory>
+
+namespace fn::Benchmarks::Cases
+{
+  namespace
+  {
+    constexpr size KEY_COUNT{4'096};
+    constexpr size BLOCK_SIZE{64};
+
+    struct BenchmarkAllocation
+    {
+      static constexpr strv NAME{"benchmarks"};
+    };
+
+    template <typename T>
+    using Tracking = Memory::TrackingAllocator<T, std::allocator<T>, BenchmarkAllocation>;
+
+    template <typename TAllocator>
+    auto allocateBlock(Harness::State& state) -> none
+    {
+      TAllocator allocator;
+      for ([[maybe_unused]] const size iteration : state)
+      {
+        auto* const block{allocator.allocate(BLOCK_SIZE)};
+        Harness::doNotOptimize(block);
+        allocator.deallocate(block, BLOCK_SIZE);
+      }
+    }
+
+    template <typename TAllocator>
+    auto pushBack(Harness::State& state) -> none
+    {
+      const auto keys{Harness::makeRandom<u64>(KEY_COUNT)};
+      state.setItemCount(KEY_COUNT);
+      for ([[maybe_unused]] const size iteration : state)
+      {
+        vec<u64, TAllocator> values;
+        for (const auto key : keys)
+        {
+          values.push_back(key);
+        }
+        Harness::doNotOptimize(values);
+      }
+    }
+
+    template <typename TAllocator>
+    auto insert(Harness::State& state) -> none
+    {
+      const auto keys{Harness::makeRandom<u64>(KEY_COUNT)};
+      state.setItemCount(KEY_COUNT);
+      for ([[maybe_unused]] const size iteration : state)
+      {
+        map<u64, u64, std::less<>, TAllocator> values;
+        for (const auto key : keys)
+        {
+          values.emplace(key, key);
+        }
+        Harness::doNotOptimize(values);
+      }
+    }
+  } // namespace
+
+  auto registerMemory(Harness::Registry& registry) -> none
+  {
+    registry.add("memory/allocate/std_allocator", allocateBlock<std::allocator<byte>>)
+      .add("memory/allocate/tracking_allocator", allocateBlock<Tracking<byte>>)
+      .add("memory/vec_push_back/std_allocator", pushBack<std::allocator<u64>>)
+      .add("memory/vec_push_back/tracking_allocator", pushBack<Tracking<u64>>)
+      .add("memory/map_insert/std_allocator", insert<std::allocator<pair<const u64, u64>>>)
+      .add("memory/map_insert/tracking_allocator", insert<Tracking<pair<const u64, u64>>>)
+      .add(
+        "memory/statistics/snapshot",
+        [](Harness::State& state) -> none
+        {
+          using Memory::AllocationRegistry;
+          for ([[maybe_unused]] const size iteration : state)
+          {
+            Harness::doNotOptimize(AllocationRegistry::getStatistics<BenchmarkAllocation>());
+          }
+        }
+      );
+  }
+} // namespace fn::Benchmarks::Cases
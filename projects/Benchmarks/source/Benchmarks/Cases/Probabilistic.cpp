@@ -0,0 +1,178 @@
+#include "Benchmarks/Cases/cases.hpp"
+#include "Benchmarks/Harness/State.ipp"
+#include "Benchmarks/Harness/random.ipp"
+#include "Foundation/Probabilistic/BloomFilter.ipp"
+#include "Foundation/Probabilistic/CuckooFilter.ipp"
+#include "Foundation/Probabilistic/HyperLogLog.ipp"
+#include "Foundation/concepts.hpp"
+#include "Foundation/containers.hpp"
+#include "Foundation/types.hpp"
+#include "Foundation/utilities.hpp"
+
+namespace fn::Benchmarks::Cases
+{
+  namespace
+  {
+    constexpr size KEY_COUNT{65'536};
+    constexpr f64  FALSE_POSITIVE_RATE{0.01};
+    constexpr u8   PRECISION{14};
+
+    /**
+     * @brief The target false-positive rates that the memory of the Bloom filter is traded for.
+     */
+    constexpr arr<pair<f64, strv>, 4> FALSE_POSITIVE_RATES{
+      {{0.1, "0.1"}, {0.01, "0.01"}, {0.001, "0.001"}, {0.0001, "0.0001"}}
+    };
+
+    template <typename TSet>
+    auto makeSet() -> TSet
+    {
+      if constexpr (IsSameAs<TSet, bloom<u64>>)
+      {
+        return TSet{KEY_COUNT, FALSE_POSITIVE_RATE};
+      }
+      else if constexpr (IsSameAs<TSet, cuckoo_filter<u64>>)
+      {
+        return TSet{KEY_COUNT};
+      }
+      else if constexpr (IsSameAs<TSet, hll<u64>>)
+      {
+        return TSet{PRECISION};
+      }
+      else
+      {
+        return TSet{};
+      }
+    }
+
+    template <typename TSet>
+    auto insert(TSet& set, const u64 key) -> none
+    {
+      if constexpr (IsSameAs<TSet, cuckoo_filter<u64>>)
+      {
+        Harness::doNotOptimize(set.insert(key));
+      }
+      else
+      {
+        set.insert(key);
+      }
+    }
+
+    template <typename TSet>
+    auto insertKeys(Harness::State& state) -> none
+    {
+      const auto keys{Harness::makeRandom<u64>(KEY_COUNT)};
+      state.setItemCount(KEY_COUNT);
+      for ([[maybe_unused]] const size iteration : state)
+      {
+        auto set{makeSet<TSet>()};
+        for (const auto key : keys)
+        {
+          insert(set, key);
+        }
+        Harness::doNotOptimize(set);
+      }
+    }
+
+    template <typename TSet>
+    auto containsKeys(Harness::State& state) -> none
+    {
+      // Query as many absent keys as present ones
+      const auto keys{Harness::makeRandom<u64>(KEY_COUNT)};
+      const auto queries{Harness::makeRandom<u64>(KEY_COUNT, 0, ~u64{0}, Harness::SEED + 1)};
+      auto       set{makeSet<TSet>()};
+      for (size index{0}; index < KEY_COUNT; ++index)
+      {
+        insert(set, keys[index]);
+      }
+      state.setItemCount(2 * KEY_COUNT);
+      for ([[maybe_unused]] const size iteration : state)
+      {
+        for (size index{0}; index < KEY_COUNT; ++index)
+        {
+          Harness::doNotOptimize(set.contains(keys[index]));
+          Harness::doNotOptimize(set.contains(queries[index]));
+        }
+      }
+    }
+
+    template <typename TSet>
+    auto measureFalsePositives(Harness::State& state, TSet set) -> none
+    {
+      // Fill the filter and query keys that were never inserted
+      const auto keys{Harness::makeRandom<u64>(KEY_COUNT)};
+      const auto queries{Harness::makeRandom<u64>(KEY_COUNT, 0, ~u64{0}, Harness::SEED + 1)};
+      for (const auto key : keys)
+      {
+        insert(set, key);
+      }
+      state.setItemCount(KEY_COUNT);
+      for ([[maybe_unused]] const size iteration : state)
+      {
+        for (const auto query : queries)
+        {
+          Harness::doNotOptimize(set.contains(query));
+        }
+      }
+
+      // Report the achieved rate against the memory spent per key
+      size falsePositiveCount{0};
+      for (const auto query : queries)
+      {
+        falsePositiveCount += static_cast<size>(set.contains(query));
+      }
+      state.setCounter(
+        "false_positive_rate", static_cast<f64>(falsePositiveCount) / static_cast<f64>(KEY_COUNT)
+      );
+      state.setCounter(
+        "bits_per_key", static_cast<f64>(8 * set.getByteCount()) / static_cast<f64>(KEY_COUNT)
+      );
+    }
+  } // namespace
+
+  auto registerProbabilistic(Harness::Registry& registry) -> none
+  {
+    registry.add("probabilistic/insert/uset", insertKeys<uset<u64>>)
+      .add("probabilistic/insert/bloom", insertKeys<bloom<u64>>)
+      .add("probabilistic/insert/cuckoo_filter", insertKeys<cuckoo_filter<u64>>)
+      .add("probabilistic/insert/hll", insertKeys<hll<u64>>)
+      .add("probabilistic/contains/uset", containsKeys<uset<u64>>)
+      .add("probabilistic/contains/bloom", containsKeys<bloom<u64>>)
+      .add("probabilistic/contains/cuckoo_filter", containsKeys<cuckoo_filter<u64>>)
+      .add(
+        "probabilistic/estimate/hll",
+        [](Harness::State& state) -> none
+        {
+          auto sketch{makeSet<hll<u64>>()};
+          for (const auto key : Harness::makeRandom<u64>(KEY_COUNT))
+          {
+            sketch.insert(key);
+          }
+          for ([[maybe_unused]] const size iteration : state)
+          {
+            Harness::doNotOptimize(sketch.estimate());
+          }
+        }
+      );
+
+    // Trade memory for accuracy, with the fixed 16-bit fingerprints of the cuckoo filter as the
+    // point of reference
+    for (const auto& [rate, label] : FALSE_POSITIVE_RATES)
+    {
+      registry.add(
+        str{"probabilistic/false_positive/bloom/"} + str{label},
+        [rate](Harness::State& state) -> none
+        {
+          measureFalsePositives(state, bloom<u64>{KEY_COUNT, rate});
+        }
+      );
+    }
+    registry.add(
+      "probabilistic/false_positive/cuckoo_filter",
+      [](Harness::State& state) -> none
+      {
+        measureFalsePositives(state, cuckoo_filter<u64>{KEY_COUNT});
+      }
+    );
+  }
+} // namespace fn::Benchmarks::Cases
@@ -0,0 +1,259 @@
+#include "Benchmarks/Cases/cases.hpp"
+#include "Benchmarks/Harness/State.ipp"
+#include "Benchmarks/Harness/random.ipp"
+#include "Foundation/Serial/Encoding.ipp"
+#include "Foundation/Serial/Reader.ipp"
+#include "Foundation/Serial/serialize.ipp"
+#include "Foundation/concepts.hpp"
+#include "Foundation/containers.hpp"
+#include "Foundation/types.hpp"
+
+#include <iomanip>
+#include <limits>
+#include <span>
+#include <sstream>
+#include <string>
+#include <utility>
+
+namespace fn::Benchmarks::Cases
+{
+  namespace
+  {
+    using Serial::Encoding;
+
+    constexpr size VALUE_COUNT{65'536};
+    constexpr size RECORD_COUNT{4'096};
+
+    using Records = map<str, i64>;
+
+    auto makeNumbers() -> vec<f64>
+    {
+      return Harness::makeRandom<f64>(VALUE_COUNT, -1e6, 1e6);
+    }
+
+    auto makeCounters() -> vec<u32>
+    {
+      // Mostly small values, which is where the variable-length encoding pays off
+      return Harness::makeRandom<u32>(VALUE_COUNT, 0, 1'000);
+    }
+
+    auto makeRecords() -> Records
+    {
+      Records records;
+      const auto keys{Harness::makeRandom<u64>(RECORD_COUNT)};
+      const auto values{Harness::makeRandom<i64>(RECORD_COUNT, -1'000'000, 1'000'000)};
+      for (size index{0}; index < RECORD_COUNT; ++index)
+      {
+        records.emplace("record-" + std::to_string(keys[index]), values[index]);
+      }
+      return records;
+    }
+
+    template <typename T>
+    auto writeStream(std::ostream& os, const T& value) -> none
+    {
+      if constexpr (IsSameAs<T, Records>)
+      {
+        for (const auto& [key, count] : value)
+        {
+          os << key << ' ' << count << '\n';
+        }
+      }
+      else
+      {
+        os << std::setprecision(std::numeric_limits<typename T::value_type>::max_digits10);
+        for (const auto element : value)
+        {
+          os << element << ' ';
+        }
+      }
+    }
+
+    template <typename T>
+    auto readStream(std::istream& is) -> T
+    {
+      T value;
+      if constexpr (IsSameAs<T, Records>)
+      {
+        str key;
+        i64 count{};
+        while (is >> key >> count)
+        {
+          value.emplace_hint(value.end(), std::move(key), count);
+        }
+      }
+      else
+      {
+        typename T::value_type element{};
+        while (is >> element)
+        {
+          value.push_back(element);
+        }
+      }
+      return value;
+    }
+
+    template <typename T, Encoding encoding>
+    auto writeSerial(Harness::State& state, const T& value, const size itemCount) -> none
+    {
+      state.setItemCount(itemCount);
+      for ([[maybe_unused]] const size iteration : state)
+      {
+        Harness::doNotOptimize(Serial::serialize<encoding>(value));
+      }
+    }
+
+    template <typename T, Encoding encoding>
+    auto readSerial(Harness::State& state, const T& value, const size itemCount) -> none
+    {
+      const auto bytes{Serial::serialize<encoding>(value)};
+      state.setItemCount(itemCount);
+      for ([[maybe_unused]] const size iteration : state)
+      {
+        Harness::doNotOptimize(Serial::deserialize<T, encoding>(bytes));
+      }
+    }
+
+    template <typename T>
+    auto writeIostream(Harness::State& state, const T& value, const size itemCount) -> none
+    {
+      state.setItemCount(itemCount);
+      for ([[maybe_unused]] const size iteration : state)
+      {
+        std::ostringstream stream;
+        writeStream(stream, value);
+        Harness::doNotOptimize(stream.str());
+      }
+    }
+
+    template <typename T>
+    auto readIostream(Harness::State& state, const T& value, const size itemCount) -> none
+    {
+      std::ostringstream text;
+      writeStream(text, value);
+      const auto content{text.str()};
+      state.setItemCount(itemCount);
+      for ([[maybe_unused]] const size iteration : state)
+      {
+        std::istringstream stream{content};
+        Harness::doNotOptimize(readStream<T>(stream));
+      }
+    }
+  } // namespace
+
+  auto registerSerial(Harness::Registry& registry) -> none
+  {
+    registry
+      .add(
+        "serial/write/vec_f64/iostream",
+        [](Harness::State& state) -> none
+        {
+          writeIostream(state, makeNumbers(), VALUE_COUNT);
+        }
+      )
+      .add(
+        "serial/write/vec_f64/fn_fixed",
+        [](Harness::State& state) -> none
+        {
+          writeSerial<vec<f64>, Encoding::FIXED>(state, makeNumbers(), VALUE_COUNT);
+        }
+      )
+      .add(
+        "serial/read/vec_f64/iostream",
+        [](Harness::State& state) -> none
+        {
+          readIostream(state, makeNumbers(), VALUE_COUNT);
+        }
+      )
+      .add(
+        "serial/read/vec_f64/fn_fixed",
+        [](Harness::State& state) -> none
+        {
+          readSerial<vec<f64>, Encoding::FIXED>(state, makeNumbers(), VALUE_COUNT);
+        }
+      )
+      .add(
+        "serial/read/vec_f64/fn_view",
+        [](Harness::State& state) -> none
+        {
+          const auto bytes{Serial::serialize(makeNumbers())};
+          state.setItemCount(VALUE_COUNT);
+          for ([[maybe_unused]] const size iteration : state)
+          {
+            Serial::Reader reader{bytes};
+            Harness::doNotOptimize(reader.read<std::span<const f64>>());
+          }
+        }
+      )
+      .add(
+        "serial/write/vec_u32/iostream",
+        [](Harness::State& state) -> none
+        {
+          writeIostream(state, makeCounters(), VALUE_COUNT);
+        }
+      )
+      .add(
+        "serial/write/vec_u32/fn_fixed",
+        [](Harness::State& state) -> none
+        {
+          writeSerial<vec<u32>, Encoding::FIXED>(state, makeCounters(), VALUE_COUNT);
+        }
+      )
+      .add(
+        "serial/write/vec_u32/fn_varint",
+        [](Harness::State& state) -> none
+        {
+          writeSerial<vec<u32>, Encoding::VARINT>(state, makeCounters(), VALUE_COUNT);
+        }
+      )
+      .add(
+        "serial/read/vec_u32/iostream",
+        [](Harness::State& state) -> none
+        {
+          readIostream(state, makeCounters(), VALUE_COUNT);
+        }
+      )
+      .add(
+        "serial/read/vec_u32/fn_fixed",
+        [](Harness::State& state) -> none
+        {
+          readSerial<vec<u32>, Encoding::FIXED>(state, makeCounters(), VALUE_COUNT);
+        }
+      )
+      .add(
+        "serial/read/vec_u32/fn_varint",
+        [](Harness::State& state) -> none
+        {
+          readSerial<vec<u32>, Encoding::VARINT>(state, makeCounters(), VALUE_COUNT);
+        }
+      )
+      .add(
+        "serial/write/map_str_i64/iostream",
+        [](Harness::State& state) -> none
+        {
+          writeIostream(state, makeRecords(), RECORD_COUNT);
+        }
+      )
+      .add(
+        "serial/write/map_str_i64/fn_varint",
+        [](Harness::State& state) -> none
+        {
+          writeSerial<Records, Encoding::VARINT>(state, makeRecords(), RECORD_COUNT);
+        }
+      )
+      .add(
+        "serial/read/map_str_i64/iostream",
+        [](Harness::State& state) -> none
+        {
+          readIostream(state, makeRecords(), RECORD_COUNT);
+        }
+      )
+      .add(
+        "serial/read/map_str_i64/fn_varint",
+        [](Harness::State& state) -> none
+        {
+          readSerial<Records, Encoding::VARINT>(state, makeRecords(), RECORD_COUNT);
+        }
+      );
+  }
+} // namespace fn::Benchmarks::Cases
@@ -0,0 +1,81 @@
+#include "Benchmarks/Cases/cases.hpp"
+#include "Benchmarks/Harness/State.ipp"
+#include "Benchmarks/Harness/random.ipp"
+#include "Foundation/Support/narrow.ipp"
+#include "Foundation/errors.hpp"
+#include "Foundation/types.hpp"
+
+#include <limits>
+
+namespace fn::Benchmarks::Cases
+{
+  namespace
+  {
+    constexpr size VALUE_COUNT{1'024};
+
+    template <typename TTo, typename TFrom>
+    auto makeNarrowable() -> vec<TFrom>
+    {
+      // Generate values that survive the conversion, widened from the target type
+      const auto narrowValues{Harness::makeRandom<TTo>(VALUE_COUNT)};
+      return {narrowValues.begin(), narrowValues.end()};
+    }
+
+    template <typename TTo, typename TFrom>
+    auto staticCast(Harness::State& state) -> none
+    {
+      const auto values{makeNarrowable<TTo, TFrom>()};
+      state.setItemCount(VALUE_COUNT);
+      for ([[maybe_unused]] const size iteration : state)
+      {
+        for (const auto value : values)
+        {
+          Harness::doNotOptimize(static_cast<TTo>(value));
+        }
+      }
+    }
+
+    template <typename TTo, typename TFrom>
+    auto narrowCast(Harness::State& state) -> none
+    {
+      const auto values{makeNarrowable<TTo, TFrom>()};
+      state.setItemCount(VALUE_COUNT);
+      for ([[maybe_unused]] const size iteration : state)
+      {
+        for (const auto value : values)
+        {
+          Harness::doNotOptimize(narrow_cast<TTo>(value));
+        }
+      }
+    }
+
+    auto narrowCastFailure(Harness::State& state) -> none
+    {
+      const auto value{static_cast<i64>(std::numeric_limits<i32>::max()) + 1};
+      for ([[maybe_unused]] const size iteration : state)
+      {
+        try
+        {
+          Harness::doNotOptimize(narrow_cast<i32>(value));
+        }
+        catch (const NarrowingError& error)
+        {
+          Harness::doNotOptimize(error);
+        }
+      }
+    }
+  } // namespace
+
+  auto registerSupport(Harness::Registry& registry) -> none
+  {
+    registry.add("support/static_cast/i64_i32", staticCast<i32, i64>)
+      .add("support/narrow_cast/i64_i32", narrowCast<i32, i64>)
+      .add("support/static_cast/u64_u8", staticCast<u8, u64>)
+      .add("support/narrow_cast/u64_u8", narrowCast<u8, u64>)
+      .add("support/static_cast/i64_u32", staticCast<u32, i64>)
+      .add("support/narrow_cast/i64_u32", narrowCast<u32, i64>)
+      .add("support/static_cast/f64_f32", staticCast<f32, f64>)
+      .add("support/narrow_cast/f64_f32", narrowCast<f32, f64>)
+      .add("support/narrow_cast/failure", narrowCastFailure);
+  }
+} // namespace fn::Benchmarks::Cases
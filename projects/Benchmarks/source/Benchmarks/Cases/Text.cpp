@@ -0,0 +1,180 @@
+#include "Benchmarks/Cases/cases.hpp"
+#include "Benchmarks/Harness/State.ipp"
+#include "Benchmarks/Harness/random.ipp"
+#include "Foundation/Text/format.ipp"
+#include "Foundation/Text/parse.ipp"
+#include "Foundation/concepts.hpp"
+#include "Foundation/containers.hpp"
+#include "Foundation/types.hpp"
+
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <iomanip>
+#include <limits>
+#include <sstream>
+
+namespace fn::Benchmarks::Cases
+{
+  namespace
+  {
+    constexpr size VALUE_COUNT{16'384};
+
+    template <typename T>
+    auto makeValues() -> vec<T>
+    {
+      if constexpr (IsIntegral<T>)
+      {
+        return Harness::makeRandom<T>(VALUE_COUNT);
+      }
+      else
+      {
+        return Harness::makeRandom<T>(VALUE_COUNT, T{-1e6}, T{1e6});
+      }
+    }
+
+    template <typename T>
+    auto formatCsv(const vec<T>& values) -> str
+    {
+      // Join the shortest round-trip forms with commas
+      str                                 csv;
+      arr<cdef, Text::FORMAT_CAPACITY<T>> buffer{};
+      for (const auto value : values)
+      {
+        csv += Text::format(value, buffer);
+        csv += ',';
+      }
+      return csv;
+    }
+
+    template <typename T>
+    auto formatFn(Harness::State& state) -> none
+    {
+      const auto values{makeValues<T>()};
+      state.setItemCount(VALUE_COUNT);
+      for ([[maybe_unused]] const size iteration : state)
+      {
+        Harness::doNotOptimize(formatCsv(values));
+      }
+    }
+
+    template <typename T>
+    auto formatStream(Harness::State& state) -> none
+    {
+      const auto values{makeValues<T>()};
+      state.setItemCount(VALUE_COUNT);
+      for ([[maybe_unused]] const size iteration : state)
+      {
+        std::ostringstream stream;
+        stream << std::setprecision(std::numeric_limits<T>::max_digits10);
+        for (const auto value : values)
+        {
+          stream << value << ',';
+        }
+        Harness::doNotOptimize(stream.str());
+      }
+    }
+
+    template <typename T>
+    auto formatPrintf(Harness::State& state) -> none
+    {
+      const auto values{makeValues<T>()};
+      state.setItemCount(VALUE_COUNT);
+      for ([[maybe_unused]] const size iteration : state)
+      {
+        str                                 csv;
+        arr<cdef, Text::FORMAT_CAPACITY<T>> buffer{};
+        for (const auto value : values)
+        {
+          // NOLINTBEGIN(cppcoreguidelines-pro-type-vararg, hicpp-vararg)
+          idef length{0};
+          if constexpr (IsIntegral<T>)
+          {
+            length = std::snprintf(buffer.data(), buffer.size(), "%" PRId64 ",", value);
+          }
+          else
+          {
+            length = std::snprintf(buffer.data(), buffer.size(), "%.17g,", value);
+          }
+          // NOLINTEND(cppcoreguidelines-pro-type-vararg, hicpp-vararg)
+          csv.append(buffer.data(), static_cast<size>(length));
+        }
+        Harness::doNotOptimize(csv);
+      }
+    }
+
+    template <typename T>
+    auto parseFn(Harness::State& state) -> none
+    {
+      const auto csv{formatCsv(makeValues<T>())};
+      state.setItemCount(VALUE_COUNT);
+      for ([[maybe_unused]] const size iteration : state)
+      {
+        strv rest{csv};
+        while (not rest.empty())
+        {
+          const auto comma{rest.find(',')};
+          Harness::doNotOptimize(Text::parse<T>(rest.substr(0, comma)));
+          rest.remove_prefix(comma + 1);
+        }
+      }
+    }
+
+    template <typename T>
+    auto parseStream(Harness::State& state) -> none
+    {
+      const auto csv{formatCsv(makeValues<T>())};
+      state.setItemCount(VALUE_COUNT);
+      for ([[maybe_unused]] const size iteration : state)
+      {
+        std::istringstream stream{csv};
+        T                  value{};
+        cdef               comma{};
+        while (stream >> value >> comma)
+        {
+          Harness::doNotOptimize(value);
+        }
+      }
+    }
+
+    template <typename T>
+    auto parseStrto(Harness::State& state) -> none
+    {
+      const auto csv{formatCsv(makeValues<T>())};
+      state.setItemCount(VALUE_COUNT);
+      for ([[maybe_unused]] const size iteration : state)
+      {
+        cstr  begin{csv.c_str()};
+        cdef* end{nullptr};
+        while (*begin != '\0')
+        {
+          if constexpr (IsIntegral<T>)
+          {
+            Harness::doNotOptimize(std::strtoll(begin, &end, 10));
+          }
+          else
+          {
+            Harness::doNotOptimize(std::strtod(begin, &end));
+          }
+          begin = end + 1;
+        }
+      }
+    }
+  } // namespace
+
+  auto registerText(Harness::Registry& registry) -> none
+  {
+    registry.add("text/format_csv/i64/fn", formatFn<i64>)
+      .add("text/format_csv/i64/ostringstream", formatStream<i64>)
+      .add("text/format_csv/i64/snprintf", formatPrintf<i64>)
+      .add("text/format_csv/f64/fn", formatFn<f64>)
+      .add("text/format_csv/f64/ostringstream", formatStream<f64>)
+      .add("text/format_csv/f64/snprintf", formatPrintf<f64>)
+      .add("text/parse_csv/i64/fn", parseFn<i64>)
+      .add("text/parse_csv/i64/istringstream", parseStream<i64>)
+      .add("text/parse_csv/i64/strtoll", parseStrto<i64>)
+      .add("text/parse_csv/f64/fn", parseFn<f64>)
+      .add("text/parse_csv/f64/istringstream", parseStream<f64>)
+      .add("text/parse_csv/f64/strtod", parseStrto<f64>);
+  }
+} // namespace fn::Benchmarks::Cases
@@ -0,0 +1,238 @@
+#include "Benchmarks/Cases/cases.hpp"
+#include "Benchmarks/Harness/State.ipp"
+#include "Benchmarks/Harness/random.ipp"
+#include "Foundation/Timing/TimerWheel.ipp"
+#include "Foundation/containers.hpp"
+#include "Foundation/types.hpp"
+#include "Foundation/utilities.hpp"
+
+#include <functional>
+
+namespace fn::Benchmarks::Cases
+{
+  namespace
+  {
+    constexpr size TIMER_COUNT{65'536};
+    constexpr u64  HORIZON{1 << 20};
+    constexpr u64  MAX_DELAY{4'096};
+
+    /**
+     * @brief A priority queue of deadlines that cancels lazily, the usual alternative to a wheel.
+     */
+    class TimerQueue final
+    {
+    public:
+      explicit TimerQueue(const size capacity)
+        : m_isCancelled(capacity, false)
+      {
+      }
+
+      auto schedule(const u64 deadline, const u32 id) -> none
+      {
+        m_timers.emplace(deadline, id);
+      }
+
+      auto cancel(const u32 id) -> none
+      {
+        m_isCancelled[id] = true;
+      }
+
+      auto advance(const u64 now, u64& fired) -> none
+      {
+        while (not m_timers.empty() and m_timers.top().first <= now)
+        {
+          if (not m_isCancelled[m_timers.top().second])
+          {
+            ++fired;
+          }
+          m_timers.pop();
+        }
+      }
+
+    private:
+      using Timer = pair<u64, u32>;
+
+      pque<Timer, vec<Timer>, std::greater<>> m_timers;
+      vec<bln>                                m_isCancelled;
+    };
+
+    auto scheduleQueue(Harness::State& state, const bln isCancelled) -> none
+    {
+      const auto deadlines{Harness::makeRandom<u64>(TIMER_COUNT, 1, HORIZON)};
+      state.setItemCount(TIMER_COUNT);
+      for ([[maybe_unused]] const size iteration : state)
+      {
+        TimerQueue queue{TIMER_COUNT};
+        u64        fired{0};
+        for (u32 id{0}; id < TIMER_COUNT; ++id)
+        {
+          queue.schedule(deadlines[id], id);
+        }
+        if (isCancelled)
+        {
+          // Lazily cancelled timers still have to be popped
+          for (u32 id{0}; id < TIMER_COUNT; ++id)
+          {
+            queue.cancel(id);
+          }
+          queue.advance(HORIZON, fired);
+        }
+        Harness::doNotOptimize(fired);
+      }
+    }
+
+    auto scheduleWheel(Harness::State& state, const bln isCancelled) -> none
+    {
+      const auto deadlines{Harness::makeRandom<u64>(TIMER_COUNT, 1, HORIZON)};
+      vec<timer_wheel<>::Handle> handles(TIMER_COUNT);
+      state.setItemCount(TIMER_COUNT);
+      for ([[maybe_unused]] const size iteration : state)
+      {
+        timer_wheel<> wheel;
+        u64           fired{0};
+        for (size index{0}; index < TIMER_COUNT; ++index)
+        {
+          handles[index] = wheel.schedule(
+            deadlines[index],
+            [&fired]() -> none
+            {
+              ++fired;
+            }
+          );
+        }
+        if (isCancelled)
+        {
+          for (const auto handle : handles)
+          {
+            wheel.cancel(handle);
+          }
+        }
+        Harness::doNotOptimize(fired);
+      }
+    }
+
+    auto expireQueue(Harness::State& state) -> none
+    {
+      const auto deadlines{Harness::makeRandom<u64>(TIMER_COUNT, 1, HORIZON)};
+      state.setItemCount(TIMER_COUNT);
+      for ([[maybe_unused]] const size iteration : state)
+      {
+        state.pauseTiming();
+        TimerQueue queue{TIMER_COUNT};
+        u64        fired{0};
+        for (u32 id{0}; id < TIMER_COUNT; ++id)
+        {
+          queue.schedule(deadlines[id], id);
+        }
+        state.resumeTiming();
+
+        queue.advance(HORIZON, fired);
+        Harness::doNotOptimize(fired);
+      }
+    }
+
+    auto expireWheel(Harness::State& state) -> none
+    {
+      const auto deadlines{Harness::makeRandom<u64>(TIMER_COUNT, 1, HORIZON)};
+      state.setItemCount(TIMER_COUNT);
+      for ([[maybe_unused]] const size iteration : state)
+      {
+        state.pauseTiming();
+        timer_wheel<> wheel;
+        u64           fired{0};
+        for (const auto deadline : deadlines)
+        {
+          wheel.schedule(
+            deadline,
+            [&fired]() -> none
+            {
+              ++fired;
+            }
+          );
+        }
+        state.resumeTiming();
+
+        Harness::doNotOptimize(wheel.advance(HORIZON));
+        Harness::doNotOptimize(fired);
+      }
+    }
+
+    auto churnQueue(Harness::State& state) -> none
+    {
+      // Every tick schedules one timer a short delay ahead and expires the due ones
+      const auto delays{Harness::makeRandom<u64>(TIMER_COUNT, 1, MAX_DELAY)};
+      state.setItemCount(TIMER_COUNT);
+      for ([[maybe_unused]] const size iteration : state)
+      {
+        TimerQueue queue{TIMER_COUNT};
+        u64        fired{0};
+        for (u32 tick{0}; tick < TIMER_COUNT; ++tick)
+        {
+          queue.schedule(tick + delays[tick], tick);
+          queue.advance(tick, fired);
+        }
+        Harness::doNotOptimize(fired);
+      }
+    }
+
+    auto churnWheel(Harness::State& state) -> none
+    {
+      const auto delays{Harness::makeRandom<u64>(TIMER_COUNT, 1, MAX_DELAY)};
+      state.setItemCount(TIMER_COUNT);
+      for ([[maybe_unused]] const size iteration : state)
+      {
+        timer_wheel<> wheel;
+        u64           fired{0};
+        for (u64 tick{0}; tick < TIMER_COUNT; ++tick)
+        {
+          wheel.schedule(
+            tick + delays[tick],
+            [&fired]() -> none
+            {
+              ++fired;
+            }
+          );
+          wheel.advance(tick);
+        }
+        Harness::doNotOptimize(fired);
+      }
+    }
+  } // namespace
+
+  auto registerTiming(Harness::Registry& registry) -> none
+  {
+    registry
+      .add(
+        "timing/schedule/pque",
+        [](Harness::State& state) -> none
+        {
+          scheduleQueue(state, false);
+        }
+      )
+      .add(
+        "timing/schedule/timer_wheel",
+        [](Harness::State& state) -> none
+        {
+          scheduleWheel(state, false);
+        }
+      )
+      .add(
+        "timing/schedule_cancel/pque",
+        [](Harness::State& state) -> none
+        {
+          scheduleQueue(state, true);
+        }
+      )
+      .add(
+        "timing/schedule_cancel/timer_wheel",
+        [](Harness::State& state) -> none
+        {
+          scheduleWheel(state, true);
+        }
+      )
+      .add("timing/expire/pque", expireQueue)
+      .add("timing/expire/timer_wheel", expireWheel)
+      .add("timing/churn/pque", churnQueue)
+      .add("timing/churn/timer_wheel", churnWheel);
+  }
+} // namespace fn::Benchmarks::Cases
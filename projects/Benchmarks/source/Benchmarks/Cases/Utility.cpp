@@ -0,0 +1,132 @@
+#include "Benchmarks/Cases/cases.hpp"
+#include "Benchmarks/Harness/State.ipp"
+#include "Foundation/Utility/log.ipp"
+#include "Foundation/Utility/what.ipp"
+#include "Foundation/errors.hpp"
+#include "Foundation/types.hpp"
+
+#include <iostream>
+#include <stdexcept>
+#include <streambuf>
+
+namespace fn::Benchmarks::Cases
+{
+  namespace
+  {
+    /**
+     * @brief A stream buffer that discards everything, so that logging measures the formatting.
+     */
+    class NullBuffer final : public std::streambuf
+    {
+    protected:
+      auto overflow(const int_type character) -> int_type override
+      {
+        return traits_type::not_eof(character);
+      }
+
+      auto xsputn(const char_type* /*characters*/, const std::streamsize count)
+        -> std::streamsize override
+      {
+        return count;
+      }
+    };
+
+    /**
+     * @brief Redirects `std::cerr` to a `NullBuffer` for its lifetime.
+     */
+    class SilencedErrors final
+    {
+    public:
+      SilencedErrors()
+        : m_previous{std::cerr.rdbuf(&m_buffer)}
+      {
+      }
+
+      SilencedErrors(const SilencedErrors& other) = delete;
+      SilencedErrors(SilencedErrors&& other)      = delete;
+
+      ~SilencedErrors()
+      {
+        std::cerr.rdbuf(m_previous);
+      }
+
+      auto operator=(const SilencedErrors& other) -> SilencedErrors& = delete;
+      auto operator=(SilencedErrors&& other) -> SilencedErrors&      = delete;
+
+    private:
+      NullBuffer      m_buffer;
+      std::streambuf* m_previous;
+    };
+
+    template <typename T>
+    auto logStream(Harness::State& state, const T& message) -> none
+    {
+      const SilencedErrors silenced;
+      for ([[maybe_unused]] const size iteration : state)
+      {
+        std::cerr << '\n' << message << '\n';
+      }
+    }
+
+    template <typename T>
+    auto logElog(Harness::State& state, const T& message) -> none
+    {
+      const SilencedErrors silenced;
+      for ([[maybe_unused]] const size iteration : state)
+      {
+        elog(message);
+      }
+    }
+  } // namespace
+
+  auto registerUtility(Harness::Registry& registry) -> none
+  {
+    registry
+      .add(
+        "utility/cerr/cstr",
+        [](Harness::State& state) -> none
+        {
+          logStream(state, "The quick brown fox jumps over the lazy dog.");
+        }
+      )
+      .add(
+        "utility/elog/cstr",
+        [](Harness::State& state) -> none
+        {
+          logElog(state, "The quick brown fox jumps over the lazy dog.");
+        }
+      )
+      .add(
+        "utility/cerr/i64",
+        [](Harness::State& state) -> none
+        {
+          logStream(state, i64{-1'234'567'890'123});
+        }
+      )
+      .add(
+        "utility/elog/i64",
+        [](Harness::State& state) -> none
+        {
+          logElog(state, i64{-1'234'567'890'123});
+        }
+      )
+      .add(
+        "utility/elog/exception",
+        [](Harness::State& state) -> none
+        {
+          logElog(state, InputError{"Malformed record!", str{"line 42"}});
+        }
+      )
+      .add(
+        "utility/what/std_exception",
+        [](Harness::State& state) -> none
+        {
+          const std::runtime_error error{"Malformed record!"};
+          for ([[maybe_unused]] const size iteration : state)
+          {
+            Harness::doNotOptimize(what(error));
+          }
+        }
+      );
+  }
+} // namespace fn::Benchmarks::Cases
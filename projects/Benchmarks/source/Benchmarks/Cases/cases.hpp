@@ -0,0 +1,70 @@
+#pragma once
+
+#include "Benchmarks/Harness/Registry.ipp"
+#include "Foundation/types.hpp"
+
+namespace fn::Benchmarks::Cases
+{
+  /**
+   * @brief Registers the radix and parallel sorts against `std::sort`, `std::stable_sort` and,
+   *        when the parallel standard algorithms are available, `std::sort(std::execution::par)`.
+   * @param registry The registry to add the cases to.
+   * @param isLarge Whether the scaling cases at 100M and 1B elements are registered as well.
+   */
+  auto registerAlgorithms(Harness::Registry& registry, bln isLarge) -> none;
+
+  /**
+   * @brief Registers the common operations of the container aliases.
+   */
+  auto registerContainers(Harness::Registry& registry) -> none;
+
+  /**
+   * @brief Registers the resumption of tasks and generators against plain calls and loops.
+   */
+  auto registerCoroutine(Harness::Registry& registry) -> none;
+
+  /**
+   * @brief Registers the enumerator reflection against a `switch` and a hash map.
+   */
+  auto registerEnum(Harness::Registry& registry) -> none;
+
+  /**
+   * @brief Registers throwing and catching exceptions with and without stack trace capture.
+   */
+  auto registerExceptions(Harness::Registry& registry) -> none;
+
+  /**
+   * @brief Registers the overhead of the tracking allocator over `std::allocator`.
+   */
+  auto registerMemory(Harness::Registry& registry) -> none;
+
+  /**
+   * @brief Registers the probabilistic filters and sketches against a hash set.
+   */
+  auto registerProbabilistic(Harness::Registry& registry) -> none;
+
+  /**
+   * @brief Registers the binary serialization against the stream operators.
+   */
+  auto registerSerial(Harness::Registry& registry) -> none;
+
+  /**
+   * @brief Registers `narrow_cast` against `static_cast`.
+   */
+  auto registerSupport(Harness::Registry& registry) -> none;
+
+  /**
+   * @brief Registers the bulk number parsing and formatting against the streams and `strtod`.
+   */
+  auto registerText(Harness::Registry& registry) -> none;
+
+  /**
+   * @brief Registers the timer wheel against a priority queue of deadlines.
+   */
+  auto registerTiming(Harness::Registry& registry) -> none;
+
+  /**
+   * @brief Registers logging with `elog` and the exception description of `what`.
+   */
+  auto registerUtility(Harness::Registry& registry) -> none;
+} // namespace fn::Benchmarks::Cases
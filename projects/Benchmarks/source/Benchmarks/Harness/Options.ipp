@@ -0,0 +1,162 @@
+#pragma once
+
+#include "Foundation/Text/parse.ipp"
+#include "Foundation/errors.hpp"
+#include "Foundation/types.hpp"
+#include "Foundation/utilities.hpp"
+
+#include <chrono>
+#include <span>
+
+namespace fn::Benchmarks::Harness
+{
+  /**
+   * @brief The command line options of the benchmark runner.
+   */
+  struct Options
+  {
+    /**
+     * @brief Only the cases whose names contain this text are run, all cases if it is empty.
+     */
+    str filter;
+
+    /**
+     * @brief The number of measured repetitions of each case, i.e. the number of samples, enough
+     *        for a 99th percentile that differs from the maximum.
+     */
+    size repetitionCount{100};
+
+    /**
+     * @brief The minimal duration of one repetition that the iteration count is calibrated to,
+     *        short enough that all repetitions take about half a second.
+     */
+    std::chrono::milliseconds minimumTime{5};
+
+    /**
+     * @brief The duration that each case runs unmeasured after calibration.
+     */
+    std::chrono::milliseconds warmupTime{100};
+
+    /**
+     * @brief The path of the JSON report, `-` for the standard output, no report if empty.
+     */
+    opt<str> jsonPath;
+
+    /**
+     * @brief Whether every case runs a single iteration only, to check that the cases work.
+     */
+    bln isSmoke{false};
+
+    /**
+     * @brief Whether the cases at 100M and 1B elements are run, which need tens of gigabytes.
+     */
+    bln isLarge{false};
+
+    /**
+     * @brief Whether the names of the cases are listed instead of running them.
+     */
+    bln isListing{false};
+
+    /**
+     * @brief Whether the usage is printed instead of running the cases.
+     */
+    bln isHelp{false};
+  };
+
+  /**
+   * @brief The usage of the benchmark runner.
+   */
+  inline constexpr strv USAGE{
+    "Usage: fn_benchmarks [options]\n"
+    "  --filter=<text>      Run the cases whose names contain the text.\n"
+    "  --repetitions=<n>    Measure each case n times, at least 100 for a p99 (default: 100).\n"
+    "  --min-time=<ms>      Calibrate each repetition to at least ms milliseconds, 0 for a single\n"
+    "                       iteration (default: 5).\n"
+    "  --warmup=<ms>        Run each case ms milliseconds before measuring it, 0 to skip the\n"
+    "                       warmup (default: 100).\n"
+    "  --json=<path>        Write a JSON report to the path, `-` for the standard output, which\n"
+    "                       moves the table to the standard error.\n"
+    "  --smoke              Run every case once without measuring it.\n"
+    "  --large              Add the sort cases at 100M and 1B elements (about 32 GB of memory).\n"
+    "  --list               List the names of the cases.\n"
+    "  --help               Print this usage.\n"
+  };
+
+  /**
+   * @brief   Parses the command line arguments of the benchmark runner.
+   * @param   arguments The arguments without the program name.
+   * @returns The parsed options.
+   * @note    A minimum time or a warmup of zero is accepted, unlike a repetition count of zero.
+   * @throws  ArgumentError If an argument is unknown or a count is zero.
+   * @throws  InputError If a number is malformed.
+   */
+  [[nodiscard]] auto parseOptions(std::span<const cstr> arguments) -> Options;
+} // namespace fn::Benchmarks::Harness
+
+/*------------------------------------------------------------------------------------------------*\
+*| <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<< Implementation >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>> |*
+\*------------------------------------------------------------------------------------------------*/
+
+namespace fn::Benchmarks::Harness
+{
+  [[nodiscard]] inline auto parseOptions(const std::span<const cstr> arguments) -> Options
+  {
+    Options options;
+    for (const strv argument : arguments)
+    {
+      // Split the argument into the flag and its value
+      const auto separator{argument.find('=')};
+      const auto flag{argument.substr(0, separator)};
+      const auto value{separator == strv::npos ? strv{} : argument.substr(separator + 1)};
+
+      // Apply the flag
+      if (flag == "--filter")
+      {
+        options.filter = value;
+      }
+      else if (flag == "--repetitions")
+      {
+        options.repetitionCount = Text::parse<size>(value);
+        if (options.repetitionCount == 0)
+        {
+          throw ArgumentError{"Invalid repetition count!", str{argument}};
+        }
+      }
+      else if (flag == "--min-time")
+      {
+        options.minimumTime = std::chrono::milliseconds{Text::parse<u32>(value)};
+      }
+      else if (flag == "--warmup")
+      {
+        options.warmupTime = std::chrono::milliseconds{Text::parse<u32>(value)};
+      }
+      else if (flag == "--json" and not value.empty())
+      {
+        options.jsonPath = str{value};
+      }
+      else if (argument == "--smoke")
+      {
+        options.isSmoke = true;
+      }
+      else if (argument == "--large")
+      {
+        options.isLarge = true;
+      }
+      else if (argument == "--list")
+      {
+        options.isListing = true;
+      }
+      else if (argument == "--help")
+      {
+        options.isHelp = true;
+      }
+      else
+      {
+        throw ArgumentError{"Unknown option!", str{argument}};
+      }
+    }
+
+    // Return the parsed options
+    return options;
+  }
+} // namespace fn::Benchmarks::Harness
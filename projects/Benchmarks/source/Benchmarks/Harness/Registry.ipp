@@ -0,0 +1,92 @@
+#pragma once
+
+#include "Benchmarks/Harness/State.ipp"
+#include "Foundation/containers.hpp"
+#include "Foundation/errors.hpp"
+#include "Foundation/types.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <utility>
+
+namespace fn::Benchmarks::Harness
+{
+  /**
+   * @brief A named piece of code to measure.
+   */
+  struct Case
+  {
+    str                          name;
+    std::function<none(State&)> function;
+  };
+
+  /**
+   * @brief The ordered collection of benchmark cases that the runner picks from.
+   */
+  class Registry final
+  {
+  public:
+    /*-----------------------------------------------------------------------------------+--------*\
+    *| [public]: Methods                                                                 | PUBLIC |*
+    \*-----------------------------------------------------------------------------------+--------*/
+
+    /**
+     * @brief   Adds a benchmark case.
+     * @param   name The unique name of the case, `<module>/<operation>/<variant>` by convention.
+     * @param   function The function that runs one repetition of the case.
+     * @returns The reference to this registry.
+     * @throws  ArgumentError If a case with the same name already exists.
+     */
+    auto add(str name, std::function<none(State&)> function) -> Registry&;
+
+    /*-----------------------------------------------------------------------------------+--------*\
+    *| [public]: Accessors                                                               | PUBLIC |*
+    \*-----------------------------------------------------------------------------------+--------*/
+
+    /**
+     * @brief   Gets the cases in the order they were added.
+     * @returns The cases.
+     */
+    [[nodiscard]] auto getCases() const noexcept -> const vec<Case>&;
+
+  private:
+    /*----------------------------------------------------------------------------------+---------*\
+    *| [private]: Fields                                                                | PRIVATE |*
+    \*----------------------------------------------------------------------------------+---------*/
+
+    vec<Case> m_cases;
+  };
+} // namespace fn::Benchmarks::Harness
+
+/*------------------------------------------------------------------------------------------------*\
+*| <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<< Implementation >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>> |*
+\*------------------------------------------------------------------------------------------------*/
+
+namespace fn::Benchmarks::Harness
+{
+  /*-------------------------------------------------------------------------------------+--------*\
+  *| [public]: Methods                                                                   | PUBLIC |*
+  \*-------------------------------------------------------------------------------------+--------*/
+
+  inline auto Registry::add(str name, std::function<none(State&)> function) -> Registry&
+  {
+    // Throw error if the name is taken
+    if (std::ranges::find(m_cases, name, &Case::name) != m_cases.end())
+    {
+      throw ArgumentError{"Duplicate benchmark case!", std::move(name)};
+    }
+
+    // Add the case and return the reference to this registry
+    m_cases.push_back(Case{std::move(name), std::move(function)});
+    return *this;
+  }
+
+  /*-------------------------------------------------------------------------------------+--------*\
+  *| [public]: Accessors                                                                 | PUBLIC |*
+  \*-------------------------------------------------------------------------------------+--------*/
+
+  [[nodiscard]] inline auto Registry::getCases() const noexcept -> const vec<Case>&
+  {
+    return m_cases;
+  }
+} // namespace fn::Benchmarks::Harness
@@ -0,0 +1,208 @@
+#pragma once
+
+#include "Benchmarks/Harness/Options.ipp"
+#include "Benchmarks/Harness/Runner.ipp"
+#include "Foundation/Memory/AllocationStatistics.ipp"
+#include "Foundation/Text/format.ipp"
+#include "Foundation/containers.hpp"
+#include "Foundation/types.hpp"
+
+#include <ctime>
+#include <iomanip>
+#include <ostream>
+#include <span>
+#include <thread>
+
+namespace fn::Benchmarks::Harness
+{
+  /**
+   * @brief Prints the header of the result table.
+   * @param os The stream to print to.
+   */
+  auto printHeader(std::ostream& os) -> none;
+
+  /**
+   * @brief Prints a result as a row of the result table, followed by its reported values.
+   * @param os The stream to print to.
+   * @param result The result to print.
+   */
+  auto printResult(std::ostream& os, const Result& result) -> none;
+
+  /**
+   * @brief   Writes the results as JSON for regression tracking.
+   * @details The report has a `context` object that describes the run and a `benchmarks` array
+   *          with one object per case, all times in nanoseconds per iteration. The `p99` time is
+   *          `null` with too few repetitions. The values reported by a case are added to its object
+   *          under their names.
+   * @param   os The stream to write to.
+   * @param   options The options of the run.
+   * @param   results The results to write.
+   */
+  auto writeJson(std::ostream& os, const Options& options, std::span<const Result> results)
+    -> none;
+} // namespace fn::Benchmarks::Harness
+
+/*------------------------------------------------------------------------------------------------*\
+*| <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<< Implementation >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>> |*
+\*------------------------------------------------------------------------------------------------*/
+
+namespace fn::Benchmarks::Harness::_internal
+{
+  inline constexpr idef NAME_WIDTH{56};
+  inline constexpr idef NUMBER_WIDTH{14};
+
+  inline constexpr strv COMPILER{
+#if defined(__clang__)
+    "Clang " __clang_version__
+#elif defined(__GNUC__)
+    "GCC " __VERSION__
+#else
+    "unknown"
+#endif
+  };
+
+  inline constexpr strv BUILD_TYPE{
+#if defined(NDEBUG)
+    "release"
+#else
+    "debug"
+#endif
+  };
+
+  inline auto writeString(std::ostream& os, const strv text) -> none
+  {
+    // Escape quotes, backslashes and control characters
+    os << '"';
+    for (const auto character : text)
+    {
+      if (character == '"' or character == '\\')
+      {
+        os << '\\' << character;
+      }
+      else if (static_cast<u8>(character) < 0x20)
+      {
+        os << "\\u00" << std::hex << std::setw(2) << std::setfill('0')
+           << static_cast<udef>(character) << std::dec << std::setfill(' ');
+      }
+      else
+      {
+        os << character;
+      }
+    }
+    os << '"';
+  }
+
+  inline auto writeNumber(std::ostream& os, const f64 number) -> none
+  {
+    // Write the shortest form that parses back to the same number
+    arr<cdef, Text::FORMAT_CAPACITY<f64>> buffer{};
+    os << Text::format(number, buffer);
+  }
+
+  inline auto getDate() -> str
+  {
+    // Format the current time as an ISO 8601 timestamp in UTC
+    const auto now{std::time(nullptr)};
+    arr<cdef, 32> buffer{};
+    const auto length{
+      std::strftime(buffer.data(), buffer.size(), "%Y-%m-%dT%H:%M:%SZ", std::gmtime(&now)) // NOLINT
+    };
+    return str{buffer.data(), length};
+  }
+} // namespace fn::Benchmarks::Harness::_internal
+
+namespace fn::Benchmarks::Harness
+{
+  inline auto printHeader(std::ostream& os) -> none
+  {
+    os << std::left << std::setw(_internal::NAME_WIDTH) << "case" << std::right
+       << std::setw(_internal::NUMBER_WIDTH) << "median ns" << std::setw(_internal::NUMBER_WIDTH)
+       << "p99 ns" << std::setw(_internal::NUMBER_WIDTH) << "iterations"
+       << std::setw(_internal::NUMBER_WIDTH) << "items/s" << '\n'
+       << str(static_cast<size>(_internal::NAME_WIDTH + 4 * _internal::NUMBER_WIDTH), '-')
+       << '\n';
+  }
+
+  inline auto printResult(std::ostream& os, const Result& result) -> none
+  {
+    os << std::left << std::setw(_internal::NAME_WIDTH) << result.name << std::right << std::fixed
+       << std::setprecision(1) << std::setw(_internal::NUMBER_WIDTH) << result.median
+       << std::setw(_internal::NUMBER_WIDTH);
+    if (result.p99.has_value())
+    {
+      os << *result.p99;
+    }
+    else
+    {
+      os << '-';
+    }
+    os << std::setw(_internal::NUMBER_WIDTH) << result.iterationCount << std::scientific
+       << std::setprecision(3)
+       << std::setw(_internal::NUMBER_WIDTH) << result.itemsPerSecond << std::defaultfloat;
+    for (const auto& [name, value] : result.counters)
+    {
+      os << "  " << name << '=' << value;
+    }
+    os << std::endl;
+  }
+
+  inline auto writeJson(
+    std::ostream& os, const Options& options, const std::span<const Result> results
+  ) -> none
+  {
+    // Write the context of the run
+    os << "{\n  \"context\": {\n    \"date\": ";
+    _internal::writeString(os, _internal::getDate());
+    os << ",\n    \"compiler\": ";
+    _internal::writeString(os, _internal::COMPILER);
+    os << ",\n    \"build_type\": ";
+    _internal::writeString(os, _internal::BUILD_TYPE);
+    os << ",\n    \"hardware_threads\": " << std::thread::hardware_concurrency()
+       << ",\n    \"repetitions\": " << options.repetitionCount
+       << ",\n    \"min_time_ms\": " << options.minimumTime.count()
+       << ",\n    \"warmup_ms\": " << options.warmupTime.count()
+       << ",\n    \"smoke\": " << (options.isSmoke ? "true" : "false")
+       << ",\n    \"allocation_tracking\": "
+       << (Memory::IS_ALLOCATION_TRACKING_ENABLED ? "true" : "false") << "\n  },\n";
+
+    // Write one object per case
+    os << "  \"benchmarks\": [";
+    for (size index{0}; index < results.size(); ++index)
+    {
+      const auto& result{results[index]};
+      os << (index == 0 ? "\n" : ",\n") << "    {\n      \"name\": ";
+      _internal::writeString(os, result.name);
+      os << ",\n      \"iterations\": " << result.iterationCount
+         << ",\n      \"repetitions\": " << result.repetitionCount
+         << ",\n      \"items_per_iteration\": " << result.itemCount
+         << ",\n      \"time_unit\": \"ns\",\n      \"median\": ";
+      _internal::writeNumber(os, result.median);
+      os << ",\n      \"p99\": ";
+      if (result.p99.has_value())
+      {
+        _internal::writeNumber(os, *result.p99);
+      }
+      else
+      {
+        os << "null";
+      }
+      os << ",\n      \"mean\": ";
+      _internal::writeNumber(os, result.mean);
+      os << ",\n      \"min\": ";
+      _internal::writeNumber(os, result.minimum);
+      os << ",\n      \"max\": ";
+      _internal::writeNumber(os, result.maximum);
+      os << ",\n      \"items_per_second\": ";
+      _internal::writeNumber(os, result.itemsPerSecond);
+      for (const auto& [name, value] : result.counters)
+      {
+        os << ",\n      ";
+        _internal::writeString(os, name);
+        os << ": ";
+        _internal::writeNumber(os, value);
+      }
+      os << "\n    }";
+    }
+    os << (results.empty() ? "]\n}\n" : "\n  ]\n}\n");
+  }
+} // namespace fn::Benchmarks::Harness
@@ -0,0 +1,235 @@
+#pragma once
+
+#include "Benchmarks/Harness/Options.ipp"
+#include "Benchmarks/Harness/Registry.ipp"
+#include "Benchmarks/Harness/State.ipp"
+#include "Foundation/containers.hpp"
+#include "Foundation/types.hpp"
+#include "Foundation/utilities.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <numeric>
+#include <utility>
+
+namespace fn::Benchmarks::Harness
+{
+  /**
+   * @brief The statistics of the repetitions of a benchmark case.
+   */
+  struct Result
+  {
+    str  name;
+    size iterationCount;
+    size repetitionCount;
+    size itemCount;
+    f64  median;
+    f64  mean;
+    f64  minimum;
+    f64  maximum;
+    f64  itemsPerSecond;
+
+    /**
+     * @brief The 99th percentile by nearest rank, only given enough samples to differ from the
+     *        maximum.
+     */
+    opt<f64> p99;
+
+    /**
+     * @brief The values reported by the last repetition, e.g. a measured error rate.
+     */
+    map<str, f64> counters;
+  };
+
+  /**
+   * @brief   Measures benchmark cases.
+   * @details The iteration count of a case is first calibrated by growing it until one repetition
+   *          takes the minimum time. The case then runs unmeasured for the warmup time before it is
+   *          measured for the configured number of repetitions. Every repetition gives one sample,
+   *          the time per iteration, and the result summarizes the samples. The 99th percentile is
+   *          only reported from `MIN_P99_SAMPLE_COUNT` samples on, below which it is the maximum.
+   */
+  class Runner final
+  {
+  public:
+    /*-----------------------------------------------------------------------------------+--------*\
+    *| [public]: Constants                                                               | PUBLIC |*
+    \*-----------------------------------------------------------------------------------+--------*/
+
+    /**
+     * @brief The minimal number of samples that the 99th percentile is reported for.
+     */
+    static constexpr size MIN_P99_SAMPLE_COUNT{100};
+
+    /*-----------------------------------------------------------------------------------+--------*\
+    *| [public]: Constructors                                                            | PUBLIC |*
+    \*-----------------------------------------------------------------------------------+--------*/
+
+    /**
+     * @brief Constructs a runner.
+     * @param options The options of the run.
+     */
+    explicit Runner(const Options& options);
+
+    /*-----------------------------------------------------------------------------------+--------*\
+    *| [public]: Methods                                                                 | PUBLIC |*
+    \*-----------------------------------------------------------------------------------+--------*/
+
+    /**
+     * @brief   Measures a benchmark case.
+     * @param   benchmark The case to measure.
+     * @returns The statistics of the repetitions, in nanoseconds per iteration.
+     */
+    [[nodiscard]] auto run(const Case& benchmark) const -> Result;
+
+  private:
+    /*----------------------------------------------------------------------------------+---------*\
+    *| [private]: Constants                                                             | PRIVATE |*
+    \*----------------------------------------------------------------------------------+---------*/
+
+    static constexpr size MAX_ITERATION_COUNT{1'000'000'000};
+
+    /*----------------------------------------------------------------------------------+---------*\
+    *| [private]: Methods                                                               | PRIVATE |*
+    \*----------------------------------------------------------------------------------+---------*/
+
+    [[nodiscard]] static auto measure(const Case& benchmark, size iterationCount) -> State;
+    [[nodiscard]] auto calibrate(const Case& benchmark) const -> size;
+    [[nodiscard]] static auto summarize(
+      const Case& benchmark, size iterationCount, const State& state, vec<f64> samples
+    ) -> Result;
+
+    /*----------------------------------------------------------------------------------+---------*\
+    *| [private]: Fields                                                                | PRIVATE |*
+    \*----------------------------------------------------------------------------------+---------*/
+
+    Options m_options;
+  };
+} // namespace fn::Benchmarks::Harness
+
+/*------------------------------------------------------------------------------------------------*\
+*| <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<< Implementation >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>> |*
+\*------------------------------------------------------------------------------------------------*/
+
+namespace fn::Benchmarks::Harness
+{
+  /*-------------------------------------------------------------------------------------+--------*\
+  *| [public]: Constructors                                                              | PUBLIC |*
+  \*-------------------------------------------------------------------------------------+--------*/
+
+  inline Runner::Runner(const Options& options)
+    : m_options{options}
+  {
+  }
+
+  /*-------------------------------------------------------------------------------------+--------*\
+  *| [public]: Methods                                                                   | PUBLIC |*
+  \*-------------------------------------------------------------------------------------+--------*/
+
+  [[nodiscard]] inline auto Runner::run(const Case& benchmark) const -> Result
+  {
+    // Run a single iteration in smoke mode
+    if (m_options.isSmoke)
+    {
+      const auto state{measure(benchmark, 1)};
+      return summarize(benchmark, 1, state, {static_cast<f64>(state.getElapsed().count())});
+    }
+
+    // Calibrate the iteration count and warm up
+    const auto iterationCount{calibrate(benchmark)};
+    std::chrono::nanoseconds warmup{0};
+    while (warmup < m_options.warmupTime)
+    {
+      warmup += measure(benchmark, iterationCount).getElapsed();
+    }
+
+    // Take one sample per repetition
+    vec<f64> samples;
+    State    state{0};
+    samples.reserve(m_options.repetitionCount);
+    for (size repetition{0}; repetition < m_options.repetitionCount; ++repetition)
+    {
+      state = measure(benchmark, iterationCount);
+      samples.push_back(
+        static_cast<f64>(state.getElapsed().count()) / static_cast<f64>(iterationCount)
+      );
+    }
+
+    // Return the statistics of the samples
+    return summarize(benchmark, iterationCount, state, std::move(samples));
+  }
+
+  /*------------------------------------------------------------------------------------+---------*\
+  *| [private]: Methods                                                                 | PRIVATE |*
+  \*------------------------------------------------------------------------------------+---------*/
+
+  [[nodiscard]] inline auto Runner::measure(const Case& benchmark, const size iterationCount)
+    -> State
+  {
+    State state{iterationCount};
+    benchmark.function(state);
+    return state;
+  }
+
+  [[nodiscard]] inline auto Runner::calibrate(const Case& benchmark) const -> size
+  {
+    const std::chrono::nanoseconds minimumTime{m_options.minimumTime};
+    size                           iterationCount{1};
+    while (iterationCount < MAX_ITERATION_COUNT)
+    {
+      // Stop once a repetition takes long enough
+      const auto elapsed{measure(benchmark, iterationCount).getElapsed()};
+      if (elapsed >= minimumTime)
+      {
+        break;
+      }
+
+      // Aim past the minimum time, growing at least twofold and at most tenfold per step
+      const auto ratio{
+        elapsed.count() == 0
+          ? 10.0
+          : 1.4 * static_cast<f64>(minimumTime.count()) / static_cast<f64>(elapsed.count())
+      };
+      iterationCount = std::min(
+        MAX_ITERATION_COUNT,
+        static_cast<size>(static_cast<f64>(iterationCount) * std::clamp(ratio, 2.0, 10.0))
+      );
+    }
+
+    // Return the calibrated iteration count
+    return iterationCount;
+  }
+
+  [[nodiscard]] inline auto Runner::summarize(
+    const Case& benchmark, const size iterationCount, const State& state, vec<f64> samples
+  ) -> Result
+  {
+    const auto itemCount{state.getItemCount()};
+    std::ranges::sort(samples);
+    const auto count{samples.size()};
+    const auto middle{count / 2};
+
+    // Take the median, and the 99th percentile by nearest rank if there are enough samples
+    const auto median{count % 2 == 0 ? (samples[middle - 1] + samples[middle]) / 2.0
+                                     : samples[middle]};
+    const auto p99Rank{static_cast<size>(std::ceil(0.99 * static_cast<f64>(count)))};
+    const auto p99{count < MIN_P99_SAMPLE_COUNT ? opt<f64>{} : samples[p99Rank - 1]};
+    const auto mean{std::accumulate(samples.begin(), samples.end(), 0.0) / static_cast<f64>(count)};
+
+    // Return the statistics
+    return Result{
+      .name            = benchmark.name,
+      .iterationCount  = iterationCount,
+      .repetitionCount = count,
+      .itemCount       = itemCount,
+      .median          = median,
+      .mean            = mean,
+      .minimum         = samples.front(),
+      .maximum         = samples.back(),
+      .itemsPerSecond  = median == 0.0 ? 0.0 : static_cast<f64>(itemCount) * 1e9 / median,
+      .p99             = p99,
+      .counters        = state.getCounters()
+    };
+  }
+} // namespace fn::Benchmarks::Harness
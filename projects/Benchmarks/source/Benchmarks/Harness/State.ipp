@@ -0,0 +1,316 @@
+#pragma once
+
+#include "Foundation/containers.hpp"
+#include "Foundation/types.hpp"
+
+#include <chrono>
+#include <type_traits>
+
+namespace fn::Benchmarks::Harness
+{
+  /**
+   * @brief   The state of one repetition of a benchmark case, iterated to run the measured code.
+   * @details The clock starts when the iteration begins and stops when it ends, so the setup before
+   *          and the teardown after the loop `for (const size iteration : state)` are not measured.
+   */
+  class State final
+  {
+  public:
+    /*-----------------------------------------------------------------------------------+--------*\
+    *| [public]: Types                                                                   | PUBLIC |*
+    \*-----------------------------------------------------------------------------------+--------*/
+
+    /**
+     * @brief An iterator over the indices of the iterations that stops the clock at the end.
+     */
+    class Iterator final
+    {
+    public:
+      /**
+       * @brief Constructs an iterator at an iteration.
+       * @param state The state that is iterated.
+       * @param index The index of the iteration.
+       */
+      Iterator(State& state, size index) noexcept;
+
+      /**
+       * @brief   Gets the index of the current iteration.
+       * @returns The index of the current iteration.
+       */
+      [[nodiscard]] auto operator*() const noexcept -> size;
+
+      /**
+       * @brief   Advances to the next iteration.
+       * @returns The reference to this iterator.
+       */
+      auto operator++() noexcept -> Iterator&;
+
+      /**
+       * @brief   Checks whether two iterators are at the same iteration, stopping the clock if so.
+       * @param   other The other iterator.
+       * @returns Whether the iterators are at the same iteration.
+       */
+      [[nodiscard]] auto operator==(const Iterator& other) const noexcept -> bln;
+
+    private:
+      State* m_state;
+      size   m_index;
+    };
+
+    /*-----------------------------------------------------------------------------------+--------*\
+    *| [public]: Constructors                                                            | PUBLIC |*
+    \*-----------------------------------------------------------------------------------+--------*/
+
+    /**
+     * @brief Constructs a state for a number of iterations.
+     * @param iterationCount The number of times the measured code runs.
+     */
+    explicit State(size iterationCount) noexcept;
+
+    /*-----------------------------------------------------------------------------------+--------*\
+    *| [public]: Methods                                                                 | PUBLIC |*
+    \*-----------------------------------------------------------------------------------+--------*/
+
+    /**
+     * @brief   Starts the clock and returns the iterator at the first iteration.
+     * @returns The iterator at the first iteration.
+     */
+    [[nodiscard]] auto begin() noexcept -> Iterator;
+
+    /**
+     * @brief   Returns the iterator past the last iteration.
+     * @returns The iterator past the last iteration.
+     */
+    [[nodiscard]] auto end() noexcept -> Iterator;
+
+    /**
+     * @brief Stops the clock, e.g. to restore the input that an iteration consumed.
+     */
+    auto pauseTiming() noexcept -> none;
+
+    /**
+     * @brief Restarts the clock after `pauseTiming`.
+     */
+    auto resumeTiming() noexcept -> none;
+
+    /*-----------------------------------------------------------------------------------+--------*\
+    *| [public]: Mutators                                                                | PUBLIC |*
+    \*-----------------------------------------------------------------------------------+--------*/
+
+    /**
+     * @brief Sets the number of items that one iteration processes, used for the throughput.
+     * @param itemCount The number of items per iteration.
+     */
+    auto setItemCount(size itemCount) noexcept -> none;
+
+    /**
+     * @brief Reports a named value next to the timings, e.g. a measured error rate.
+     * @param name The name of the value.
+     * @param value The value.
+     */
+    auto setCounter(strv name, f64 value) -> none;
+
+    /*-----------------------------------------------------------------------------------+--------*\
+    *| [public]: Accessors                                                               | PUBLIC |*
+    \*-----------------------------------------------------------------------------------+--------*/
+
+    /**
+     * @brief   Gets the number of iterations.
+     * @returns The number of iterations.
+     */
+    [[nodiscard]] auto getIterationCount() const noexcept -> size;
+
+    /**
+     * @brief   Gets the number of items that one iteration processes.
+     * @returns The number of items per iteration.
+     */
+    [[nodiscard]] auto getItemCount() const noexcept -> size;
+
+    /**
+     * @brief   Gets the measured time of all iterations.
+     * @returns The measured time in nanoseconds.
+     */
+    [[nodiscard]] auto getElapsed() const noexcept -> std::chrono::nanoseconds;
+
+    /**
+     * @brief   Gets the reported values.
+     * @returns The reported values by name.
+     */
+    [[nodiscard]] auto getCounters() const noexcept -> const map<str, f64>&;
+
+  private:
+    /*----------------------------------------------------------------------------------+---------*\
+    *| [private]: Types                                                                 | PRIVATE |*
+    \*----------------------------------------------------------------------------------+---------*/
+
+    using Clock = std::chrono::steady_clock;
+
+    /*----------------------------------------------------------------------------------+---------*\
+    *| [private]: Fields                                                                | PRIVATE |*
+    \*----------------------------------------------------------------------------------+---------*/
+
+    size                     m_iterationCount;
+    size                     m_itemCount{1};
+    bln                      m_isTiming{false};
+    Clock::time_point        m_start;
+    std::chrono::nanoseconds m_elapsed{0};
+    map<str, f64>            m_counters;
+  };
+
+  /**
+   * @brief  Forces the compiler to materialize a value that would otherwise be optimized away.
+   * @param  value The value to keep.
+   * @tparam T The type of the value.
+   */
+  template <typename T>
+  auto doNotOptimize(const T& value) noexcept -> none;
+
+  /**
+   * @brief Forces the compiler to assume that every pending write to memory is observed.
+   */
+  auto clobberMemory() noexcept -> none;
+} // namespace fn::Benchmarks::Harness
+
+/*------------------------------------------------------------------------------------------------*\
+*| <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<< Implementation >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>> |*
+\*------------------------------------------------------------------------------------------------*/
+
+namespace fn::Benchmarks::Harness
+{
+  /*-------------------------------------------------------------------------------------+--------*\
+  *| [public]: Iterator                                                                  | PUBLIC |*
+  \*-------------------------------------------------------------------------------------+--------*/
+
+  inline State::Iterator::Iterator(State& state, const size index) noexcept
+    : m_state{&state},
+      m_index{index}
+  {
+  }
+
+  [[nodiscard]] inline auto State::Iterator::operator*() const noexcept -> size
+  {
+    return m_index;
+  }
+
+  inline auto State::Iterator::operator++() noexcept -> Iterator&
+  {
+    ++m_index;
+    return *this;
+  }
+
+  [[nodiscard]] inline auto State::Iterator::operator==(const Iterator& other) const noexcept -> bln
+  {
+    // Keep iterating while there are iterations left
+    if (m_index != other.m_index)
+    {
+      return false;
+    }
+
+    // Stop the clock after the last iteration
+    m_state->pauseTiming();
+    return true;
+  }
+
+  /*-------------------------------------------------------------------------------------+--------*\
+  *| [public]: Constructors                                                              | PUBLIC |*
+  \*-------------------------------------------------------------------------------------+--------*/
+
+  inline State::State(const size iterationCount) noexcept
+    : m_iterationCount{iterationCount}
+  {
+  }
+
+  /*-------------------------------------------------------------------------------------+--------*\
+  *| [public]: Methods                                                                   | PUBLIC |*
+  \*-------------------------------------------------------------------------------------+--------*/
+
+  [[nodiscard]] inline auto State::begin() noexcept -> Iterator
+  {
+    resumeTiming();
+    return Iterator{*this, 0};
+  }
+
+  [[nodiscard]] inline auto State::end() noexcept -> Iterator
+  {
+    return Iterator{*this, m_iterationCount};
+  }
+
+  inline auto State::pauseTiming() noexcept -> none
+  {
+    if (m_isTiming)
+    {
+      m_elapsed  += Clock::now() - m_start;
+      m_isTiming  = false;
+    }
+  }
+
+  inline auto State::resumeTiming() noexcept -> none
+  {
+    if (not m_isTiming)
+    {
+      m_isTiming = true;
+      m_start    = Clock::now();
+    }
+  }
+
+  /*-------------------------------------------------------------------------------------+--------*\
+  *| [public]: Mutators                                                                  | PUBLIC |*
+  \*-------------------------------------------------------------------------------------+--------*/
+
+  inline auto State::setItemCount(const size itemCount) noexcept -> none
+  {
+    m_itemCount = itemCount;
+  }
+
+  inline auto State::setCounter(const strv name, const f64 value) -> none
+  {
+    m_counters.insert_or_assign(str{name}, value);
+  }
+
+  /*-------------------------------------------------------------------------------------+--------*\
+  *| [public]: Accessors                                                                 | PUBLIC |*
+  \*-------------------------------------------------------------------------------------+--------*/
+
+  [[nodiscard]] inline auto State::getIterationCount() const noexcept -> size
+  {
+    return m_iterationCount;
+  }
+
+  [[nodiscard]] inline auto State::getItemCount() const noexcept -> size
+  {
+    return m_itemCount;
+  }
+
+  [[nodiscard]] inline auto State::getElapsed() const noexcept -> std::chrono::nanoseconds
+  {
+    return m_elapsed;
+  }
+
+  [[nodiscard]] inline auto State::getCounters() const noexcept -> const map<str, f64>&
+  {
+    return m_counters;
+  }
+
+  /*-------------------------------------------------------------------------------------+--------*\
+  *| [public]: Functions                                                                 | PUBLIC |*
+  \*-------------------------------------------------------------------------------------+--------*/
+
+  template <typename T>
+  auto doNotOptimize(const T& value) noexcept -> none
+  {
+    // Let small values stay in a register, larger ones must be addressable
+    if constexpr (std::is_trivially_copyable_v<T> and sizeof(T) <= sizeof(T*))
+    {
+      asm volatile("" : : "r,m"(value) : "memory");
+    }
+    else
+    {
+      asm volatile("" : : "m"(value) : "memory");
+    }
+  }
+
+  inline auto clobberMemory() noexcept -> none
+  {
+    asm volatile("" : : : "memory");
+  }
+} // namespace fn::Benchmarks::Harness
@@ -0,0 +1,71 @@
+#pragma once
+
+#include "Foundation/concepts.hpp"
+#include "Foundation/containers.hpp"
+#include "Foundation/types.hpp"
+
+#include <limits>
+#include <random>
+#include <type_traits>
+
+namespace fn::Benchmarks::Harness
+{
+  /**
+   * @brief The seed of the generated inputs, fixed so that every run measures the same data.
+   */
+  inline constexpr u64 SEED{0x5EED'CAFE'F00D'BEEF};
+
+  /**
+   * @brief   Generates uniformly distributed random numbers.
+   * @param   count The number of numbers to generate.
+   * @param   minimum The smallest number that may be generated. Defaults to the lowest integer or
+   *          to `0.0` for floating-point numbers.
+   * @param   maximum The largest number that may be generated. Defaults to the largest integer or
+   *          to `1.0` for floating-point numbers.
+   * @param   seed The seed of the generator.
+   * @tparam  T The type of the numbers.
+   * @returns The generated numbers.
+   */
+  template <IsArithmetic T>
+  [[nodiscard]] auto makeRandom(
+    size count,
+    T    minimum = IsIntegral<T> ? std::numeric_limits<T>::lowest() : T{0},
+    T    maximum = IsIntegral<T> ? std::numeric_limits<T>::max() : T{1},
+    u64  seed    = SEED
+  ) -> vec<T>;
+} // namespace fn::Benchmarks::Harness
+
+/*------------------------------------------------------------------------------------------------*\
+*| <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<< Implementation >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>> |*
+\*------------------------------------------------------------------------------------------------*/
+
+namespace fn::Benchmarks::Harness
+{
+  template <IsArithmetic T>
+  [[nodiscard]] auto makeRandom(
+    const size count, const T minimum, const T maximum, const u64 seed
+  ) -> vec<T>
+  {
+    // Pick a distribution that supports every width, including the character types
+    using Distribution = std::conditional_t<
+      IsNotIntegral<T>,
+      std::uniform_real_distribution<f64>,
+      std::conditional_t<
+        IsSigned<T>,
+        std::uniform_int_distribution<i64>,
+        std::uniform_int_distribution<u64>>>;
+    using Bound = Distribution::result_type;
+
+    // Generate the numbers
+    std::mt19937_64 engine{seed};
+    Distribution    distribution{static_cast<Bound>(minimum), static_cast<Bound>(maximum)};
+    vec<T>          values(count);
+    for (auto& value : values)
+    {
+      value = static_cast<T>(distribution(engine));
+    }
+
+    // Return the numbers
+    return values;
+  }
+} // namespace fn::Benchmarks::Harness
@@ -0,0 +1,112 @@
+#include "Benchmarks/Cases/cases.hpp"
+#include "Benchmarks/Harness/Options.ipp"
+#include "Benchmarks/Harness/Registry.ipp"
+#include "Benchmarks/Harness/Report.ipp"
+#include "Benchmarks/Harness/Runner.ipp"
+#include "Foundation/Utility/log.ipp"
+#include "Foundation/Utility/what.ipp"
+#include "Foundation/containers.hpp"
+#include "Foundation/errors.hpp"
+#include "Foundation/types.hpp"
+
+#include <cstdlib>
+#include <exception>
+#include <fstream>
+#include <iostream>
+#include <ostream>
+#include <span>
+
+auto main(const fn::idef argc, const fn::cstr* const argv) -> fn::idef
+{
+  namespace Cases   = fn::Benchmarks::Cases;
+  namespace Harness = fn::Benchmarks::Harness;
+
+  try
+  {
+    // Parse the options without the program name
+    const std::span arguments{argv, static_cast<fn::size>(argc)};
+    const auto      options{Harness::parseOptions(arguments.subspan(1))};
+    if (options.isHelp)
+    {
+      std::cout << Harness::USAGE;
+      return EXIT_SUCCESS;
+    }
+
+    // Register the cases
+    Harness::Registry registry;
+    Cases::registerSupport(registry);
+    Cases::registerUtility(registry);
+    Cases::registerExceptions(registry);
+    Cases::registerContainers(registry);
+    Cases::registerCoroutine(registry);
+    Cases::registerText(registry);
+    Cases::registerAlgorithms(registry, options.isLarge);
+    Cases::registerProbabilistic(registry);
+    Cases::registerMemory(registry);
+    Cases::registerEnum(registry);
+    Cases::registerSerial(registry);
+    Cases::registerTiming(registry);
+
+    // Run the cases that pass the filter, keeping the table out of a JSON report on the output
+    const Harness::Runner   runner{options};
+    fn::vec<Harness::Result> results;
+    std::ostream&            table{options.jsonPath == "-" ? std::cerr : std::cout};
+    if (not options.isListing)
+    {
+      Harness::printHeader(table);
+    }
+    for (const auto& benchmark : registry.getCases())
+    {
+      if (not options.filter.empty() and benchmark.name.find(options.filter) == fn::str::npos)
+      {
+        continue;
+      }
+      if (options.isListing)
+      {
+        std::cout << benchmark.name << '\n';
+        continue;
+      }
+      results.push_back(runner.run(benchmark));
+      Harness::printResult(table, results.back());
+    }
+
+    // Write the JSON report
+    if (options.jsonPath == "-")
+    {
+      Harness::writeJson(std::cout, options, results);
+    }
+    else if (options.jsonPath.has_value())
+    {
+      std::ofstream file{*options.jsonPath};
+      if (not file)
+      {
+        throw fn::FileError{"Cannot open the report!", fn::str{*options.jsonPath}};
+      }
+      Harness::writeJson(file, options, results);
+    }
+    return EXIT_SUCCESS;
+  }
+  catch (const fn::ArgumentError& error)
+  {
+    fn::elog(error);
+  }
+  catch (const fn::FileError& error)
+  {
+    fn::elog(error);
+  }
+  catch (const fn::InputError& error)
+  {
+    fn::elog(error);
+  }
+  catch (const fn::NarrowingError& error)
+  {
+    fn::elog(error);
+  }
+  catch (const std::exception& exception)
+  {
+    fn::elog(fn::what(exception));
+  }
+
+  // Report the failure
+  return EXIT_FAILURE;
+}
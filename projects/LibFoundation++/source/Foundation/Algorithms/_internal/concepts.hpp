@@ -0,0 +1,25 @@
+#pragma once
+
+#include "Foundation/concepts.hpp"
+
+#include "Foundation/types.hpp"
+
+#include <concepts>
+
+namespace fn::Algorithms::_internal
+{
+  /**
+   * @brief Concept to check if a type can be used as a radix sort key, i.e. is one of the integer
+   *        or floating-point aliases.
+   */
+  template <typename T>
+  concept IsRadixKey = IsSameAs<i8, T> or IsSameAs<i16, T> or IsSameAs<i32, T> or IsSameAs<i64, T>
+                    or IsSameAs<u8, T> or IsSameAs<u16, T> or IsSameAs<u32, T> or IsSameAs<u64, T>
+                    or IsSameAs<f32, T> or IsSameAs<f64, T>;
+
+  /**
+   * @brief Concept to check if a type can be moved around by a radix sort.
+   */
+  template <typename T>
+  concept IsRadixRecord = IsMovable<T> and std::default_initializable<T>;
+} // namespace fn::Algorithms::_internal
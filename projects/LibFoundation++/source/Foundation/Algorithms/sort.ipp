@@ -0,0 +1,417 @@
+#pragma once
+
+#include "Foundation/Algorithms/_internal/concepts.hpp"
+#include "Foundation/concepts.hpp"
+#include "Foundation/containers.hpp"
+#include "Foundation/types.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <functional>
+#include <span>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+namespace fn::Algorithms
+{
+  /**
+   * @brief The execution modes of the algorithms.
+   */
+  enum class Execution : u8
+  {
+    SEQUENTIAL,
+    PARALLEL
+  };
+
+  /**
+   * @brief   Sorts the values in ascending order with an LSD radix sort.
+   * @details Integers are ordered by value. Floating-point numbers are ordered by their IEEE-754
+   *          total order, i.e. `-0.0` precedes `+0.0`, negative NaNs come first and positive NaNs
+   *          come last. The sort is stable. In parallel mode the vector is split into one chunk per
+   *          hardware thread, the chunks are radix sorted concurrently and then merged pairwise,
+   *          each merge itself split across the threads.
+   * @param   values The values to sort.
+   * @param   execution Whether to spread the work over multiple threads.
+   * @tparam  T The type of the values.
+   * @tparam  TAllocator The allocator of the vector.
+   * @note    Allocates a scratch buffer of the same size as the vector.
+   */
+  template <_internal::IsRadixKey T, typename TAllocator>
+  auto sort(vec<T, TAllocator>& values, Execution execution = Execution::SEQUENTIAL) -> none;
+
+  /**
+   * @brief   Sorts the records in ascending order of their keys with an LSD radix sort.
+   * @param   values The records to sort.
+   * @param   keyOf The callable that extracts the integral or floating-point key of a record.
+   * @param   execution Whether to spread the work over multiple threads.
+   * @tparam  T The type of the records.
+   * @tparam  TAllocator The allocator of the vector.
+   * @tparam  TKeyOf The type of the key extractor.
+   * @see     The value overload for the ordering and the parallel mode.
+   * @warning The key extractor is invoked concurrently in parallel mode and must not throw.
+   */
+  template <_internal::IsRadixRecord T, typename TAllocator, typename TKeyOf>
+  requires IsInvocableWith<const TKeyOf&, const T&>
+       and _internal::IsRadixKey<std::remove_cvref_t<std::invoke_result_t<const TKeyOf&, const T&>>>
+  auto sort(
+    vec<T, TAllocator>& values, const TKeyOf& keyOf, Execution execution = Execution::SEQUENTIAL
+  ) -> none;
+} // namespace fn::Algorithms
+
+/*------------------------------------------------------------------------------------------------*\
+*| <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<< Implementation >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>> |*
+\*------------------------------------------------------------------------------------------------*/
+
+namespace fn::Algorithms::_internal
+{
+  /**
+   * @brief The number of elements below which a comparison sort beats the radix sort.
+   */
+  inline constexpr size SMALL_SORT_THRESHOLD{256};
+
+  /**
+   * @brief The minimum number of elements handed to a single thread in parallel mode.
+   */
+  inline constexpr size PARALLEL_GRAIN{1 << 16};
+
+  /**
+   * @brief The number of bits sorted per radix pass.
+   */
+  inline constexpr size RADIX_BITS{8};
+
+  /**
+   * @brief The number of buckets per radix pass.
+   */
+  inline constexpr size RADIX_BUCKETS{size{1} << RADIX_BITS};
+
+  /**
+   * @brief  The unsigned integer type whose ascending order matches the order of `T`.
+   * @tparam T The type of the key.
+   */
+  template <IsRadixKey T>
+  using RadixKey = std::conditional_t<
+    IsIntegral<T>,
+    std::make_unsigned<T>,
+    std::conditional<IsSameAs<f32, T>, u32, u64>>::type;
+
+  // NOLINTBEGIN(readability-identifier-naming)
+
+  /**
+   * @brief   Maps a key to an unsigned integer with the same ascending order.
+   * @details Signed integers get their sign bit flipped. Floating-point numbers get their sign bit
+   *          flipped if positive, and all their bits flipped if negative.
+   * @param   key The key to map.
+   * @tparam  T The type of the key.
+   * @returns The mapped key.
+   */
+  template <IsRadixKey T>
+  [[nodiscard]] constexpr auto toRadixKey(const T key) noexcept -> RadixKey<T>
+  {
+    using Key = RadixKey<T>;
+    constexpr Key SIGN_BIT{Key{1} << ((sizeof(Key) * 8) - 1)};
+
+    // Flip the sign bit of signed integers
+    if constexpr (IsIntegral<T> and IsSigned<T>)
+    {
+      return static_cast<Key>(static_cast<Key>(key) ^ SIGN_BIT);
+    }
+    else if constexpr (IsIntegral<T>)
+    {
+      return static_cast<Key>(key);
+    }
+    else
+    {
+      // Flip all bits of negative and the sign bit of positive floating-point numbers
+      const auto bits{std::bit_cast<Key>(key)};
+      return (bits & SIGN_BIT) != 0 ? static_cast<Key>(~bits) : static_cast<Key>(bits ^ SIGN_BIT);
+    }
+  }
+
+  // NOLINTEND(readability-identifier-naming)
+
+  /**
+   * @brief Runs `task(0)` to `task(count - 1)` concurrently, one of them on the calling thread.
+   * @param count The number of tasks.
+   * @param task The task to run.
+   */
+  template <typename TTask>
+  auto parallelFor(const size count, const TTask& task) -> none
+  {
+    // Spawn a thread per task but the first
+    vec<std::jthread> threads;
+    threads.reserve(count > 0 ? count - 1 : 0);
+    for (size index{1}; index < count; ++index)
+    {
+      threads.emplace_back(task, index);
+    }
+
+    // Run the first task on the calling thread, the rest are joined on destruction
+    if (count > 0)
+    {
+      task(size{0});
+    }
+  }
+
+  // NOLINTBEGIN(cppcoreguidelines-pro-bounds-constant-array-index)
+
+  /**
+   * @brief Stable LSD radix sort of `values` using `buffer` as scratch space of the same size.
+   * @param values The records to sort.
+   * @param buffer The scratch space.
+   * @param keyOf The key extractor.
+   */
+  template <typename T, typename TKeyOf>
+  auto radixSort(const std::span<T> values, const std::span<T> buffer, const TKeyOf& keyOf)
+    -> none
+  {
+    using Key = decltype(toRadixKey(keyOf(std::declval<const T&>())));
+    constexpr size PASSES{sizeof(Key) * 8 / RADIX_BITS};
+
+    // Fall back to a comparison sort on small inputs
+    const auto keyLess{[&keyOf](const T& lhs, const T& rhs)
+                       {
+                         return toRadixKey(keyOf(lhs)) < toRadixKey(keyOf(rhs));
+                       }};
+    if (values.size() < SMALL_SORT_THRESHOLD)
+    {
+      std::stable_sort(values.begin(), values.end(), keyLess);
+      return;
+    }
+
+    // Count the digits of every pass in a single read of the input
+    arr<arr<size, RADIX_BUCKETS>, PASSES> counts{};
+    for (const T& value : values)
+    {
+      const Key key{toRadixKey(keyOf(value))};
+      for (size pass{0}; pass < PASSES; ++pass)
+      {
+        ++counts[pass][(key >> (pass * RADIX_BITS)) & (RADIX_BUCKETS - 1)];
+      }
+    }
+
+    // Scatter the records once per pass, skipping passes where every digit is the same
+    std::span<T> source{values};
+    std::span<T> target{buffer};
+    const Key    firstKey{toRadixKey(keyOf(values.front()))};
+    for (size pass{0}; pass < PASSES; ++pass)
+    {
+      const size shift{pass * RADIX_BITS};
+      auto&      offsets{counts[pass]};
+      if (offsets[(firstKey >> shift) & (RADIX_BUCKETS - 1)] == values.size())
+      {
+        continue;
+      }
+
+      // Turn the digit counts into bucket offsets
+      size offset{0};
+      for (size& count : offsets)
+      {
+        offset += std::exchange(count, offset);
+      }
+
+      // Move every record into its bucket
+      for (T& value : source)
+      {
+        target[offsets[(toRadixKey(keyOf(value)) >> shift) & (RADIX_BUCKETS - 1)]++] =
+          std::move(value);
+      }
+      std::swap(source, target);
+    }
+
+    // Move the records back if the last pass left them in the buffer
+    if (source.data() != values.data())
+    {
+      std::ranges::move(source, values.begin());
+    }
+  }
+
+  // NOLINTEND(cppcoreguidelines-pro-bounds-constant-array-index)
+
+  /**
+   * @brief   Finds how many elements of `lhs` precede the `diagonal`-th element of their stable
+   *          merge with `rhs`.
+   * @param   lhs The first sorted run.
+   * @param   rhs The second sorted run.
+   * @param   diagonal The index into the merged output.
+   * @param   less The strict ordering of the runs.
+   * @returns The number of elements taken from `lhs`.
+   */
+  template <typename T, typename TLess>
+  [[nodiscard]] auto mergePath(
+    const std::span<T> lhs, const std::span<T> rhs, const size diagonal, const TLess& less
+  ) -> size
+  {
+    // Binary search the split point along the diagonal
+    size low{diagonal > rhs.size() ? diagonal - rhs.size() : 0};
+    size high{std::min(diagonal, lhs.size())};
+    while (low < high)
+    {
+      const size middle{low + ((high - low) / 2)};
+      if (less(rhs[diagonal - middle - 1], lhs[middle]))
+      {
+        high = middle;
+      }
+      else
+      {
+        low = middle + 1;
+      }
+    }
+
+    // Return the split point
+    return low;
+  }
+
+  /**
+   * @brief Sorts `values` by radix sorting one chunk per thread and merging the chunks pairwise.
+   * @param values The records to sort.
+   * @param buffer The scratch space of the same size.
+   * @param threadCount The number of threads to use.
+   * @param keyOf The key extractor.
+   */
+  template <typename T, typename TKeyOf>
+  auto parallelSort(
+    const std::span<T> values,
+    const std::span<T> buffer,
+    const size         threadCount,
+    const TKeyOf&      keyOf
+  ) -> none
+  {
+    const auto keyLess{[&keyOf](const T& lhs, const T& rhs)
+                       {
+                         return toRadixKey(keyOf(lhs)) < toRadixKey(keyOf(rhs));
+                       }};
+
+    // Split the input into one run per thread
+    vec<size> bounds(threadCount + 1);
+    for (size index{0}; index <= threadCount; ++index)
+    {
+      bounds[index] = values.size() * index / threadCount;
+    }
+
+    // Radix sort the runs concurrently
+    parallelFor(
+      threadCount,
+      [&](const size index)
+      {
+        const size offset{bounds[index]};
+        const size count{bounds[index + 1] - offset};
+        radixSort(values.subspan(offset, count), buffer.subspan(offset, count), keyOf);
+      }
+    );
+
+    // Merge neighbouring runs until one run is left, splitting each merge across the threads
+    std::span<T> source{values};
+    std::span<T> target{buffer};
+    while (bounds.size() > 2)
+    {
+      const size runCount{bounds.size() - 1};
+      const size pairCount{(runCount + 1) / 2};
+      const size partCount{std::max<size>(1, threadCount / pairCount)};
+      parallelFor(
+        pairCount * partCount,
+        [&](const size index)
+        {
+          // Locate the runs of this pair
+          const size pair{index / partCount};
+          const size part{index % partCount};
+          const size begin{bounds[pair * 2]};
+          const size middle{bounds[std::min(pair * 2 + 1, runCount)]};
+          const size end{bounds[std::min(pair * 2 + 2, runCount)]};
+          const auto lhs{source.subspan(begin, middle - begin)};
+          const auto rhs{source.subspan(middle, end - middle)};
+
+          // Locate the slice of the merged output owned by this part
+          const size total{end - begin};
+          const size from{total * part / partCount};
+          const size to{total * (part + 1) / partCount};
+          const size lhsFrom{mergePath(lhs, rhs, from, keyLess)};
+          const size lhsTo{mergePath(lhs, rhs, to, keyLess)};
+
+          // Merge the slice
+          std::merge(
+            std::make_move_iterator(lhs.begin() + static_cast<ptrd>(lhsFrom)),
+            std::make_move_iterator(lhs.begin() + static_cast<ptrd>(lhsTo)),
+            std::make_move_iterator(rhs.begin() + static_cast<ptrd>(from - lhsFrom)),
+            std::make_move_iterator(rhs.begin() + static_cast<ptrd>(to - lhsTo)),
+            target.begin() + static_cast<ptrd>(begin + from),
+            keyLess
+          );
+        }
+      );
+
+      // Keep every other bound for the next level
+      vec<size> merged;
+      merged.reserve(pairCount + 1);
+      for (size index{0}; index < bounds.size(); index += 2)
+      {
+        merged.push_back(bounds[index]);
+      }
+      if (merged.back() != bounds.back())
+      {
+        merged.push_back(bounds.back());
+      }
+      bounds = std::move(merged);
+      std::swap(source, target);
+    }
+
+    // Move the records back if the last level left them in the buffer
+    if (source.data() != values.data())
+    {
+      parallelFor(
+        threadCount,
+        [&](const size index)
+        {
+          const size from{values.size() * index / threadCount};
+          const size to{values.size() * (index + 1) / threadCount};
+          std::move(
+            source.begin() + static_cast<ptrd>(from),
+            source.begin() + static_cast<ptrd>(to),
+            values.begin() + static_cast<ptrd>(from)
+          );
+        }
+      );
+    }
+  }
+} // namespace fn::Algorithms::_internal
+
+namespace fn::Algorithms
+{
+  template <_internal::IsRadixKey T, typename TAllocator>
+  auto sort(vec<T, TAllocator>& values, const Execution execution) -> none
+  {
+    // Sort the values by themselves
+    sort(values, std::identity{}, execution);
+  }
+
+  template <_internal::IsRadixRecord T, typename TAllocator, typename TKeyOf>
+  requires IsInvocableWith<const TKeyOf&, const T&>
+       and _internal::IsRadixKey<std::remove_cvref_t<std::invoke_result_t<const TKeyOf&, const T&>>>
+  auto sort(vec<T, TAllocator>& values, const TKeyOf& keyOf, const Execution execution) -> none
+  {
+    // Nothing to sort
+    if (values.size() < 2)
+    {
+      return;
+    }
+
+    // Decide on the number of threads
+    size threadCount{1};
+    if (execution == Execution::PARALLEL)
+    {
+      const size hardwareCount{std::max<size>(1, std::thread::hardware_concurrency())};
+      threadCount = std::clamp<size>(values.size() / _internal::PARALLEL_GRAIN, 1, hardwareCount);
+    }
+
+    // Sort with a scratch buffer of the same size
+    vec<T, TAllocator> buffer(values.size(), values.get_allocator());
+    if (threadCount == 1)
+    {
+      _internal::radixSort(std::span<T>{values}, std::span<T>{buffer}, keyOf);
+    }
+    else
+    {
+      _internal::parallelSort(std::span<T>{values}, std::span<T>{buffer}, threadCount, keyOf);
+    }
+  }
+} // namespace fn::Algorithms
@@ -0,0 +1,511 @@
+#pragma once
+
+#include "Foundation/Coroutine/_internal/FramePool.ipp"
+#include "Foundation/types.hpp"
+
+#include <coroutine>
+#include <exception>
+#include <iterator>
+#include <memory>
+#include <utility>
+
+namespace fn::Coroutine
+{
+  template <typename T>
+  class Generator;
+} // namespace fn::Coroutine
+
+namespace fn::Coroutine::_internal
+{
+  // NOLINTBEGIN(readability-identifier-naming)
+
+  /**
+   * @brief  The promise of a `Generator`.
+   * @tparam T The type of the yielded values.
+   */
+  template <typename T>
+  class GeneratorPromise final
+  {
+  public:
+    /*-----------------------------------------------------------------------------------+--------*\
+    *| [public]: Operators                                                               | PUBLIC |*
+    \*-----------------------------------------------------------------------------------+--------*/
+
+    /**
+     * @brief   Allocates the coroutine frame from the frame pool.
+     * @param   bytes The size of the frame in bytes.
+     * @returns A pointer to the allocated frame.
+     */
+    [[nodiscard]] static auto operator new(size bytes) -> void*;
+
+    /**
+     * @brief Releases the coroutine frame to the frame pool.
+     * @param frame The frame to release.
+     * @param bytes The size of the frame in bytes.
+     */
+    static auto operator delete(void* frame, size bytes) noexcept -> none;
+
+    /*-----------------------------------------------------------------------------------+--------*\
+    *| [public]: Methods                                                                 | PUBLIC |*
+    \*-----------------------------------------------------------------------------------+--------*/
+
+    /**
+     * @brief   Creates the generator that owns this promise.
+     * @returns The generator.
+     */
+    [[nodiscard]] auto get_return_object() noexcept -> Generator<T>;
+
+    /**
+     * @brief   Suspends the coroutine on creation so that generators are lazy.
+     * @returns An awaiter that always suspends.
+     */
+    [[nodiscard]] auto initial_suspend() const noexcept -> std::suspend_always;
+
+    /**
+     * @brief   Suspends the coroutine on completion so that the generator can observe it.
+     * @returns An awaiter that always suspends.
+     */
+    [[nodiscard]] auto final_suspend() const noexcept -> std::suspend_always;
+
+    /**
+     * @brief   Publishes the value produced by `co_yield` and suspends.
+     * @param   value The yielded value, kept alive by the suspended coroutine.
+     * @returns An awaiter that always suspends.
+     */
+    auto yield_value(const T& value) noexcept -> std::suspend_always;
+
+    /**
+     * @brief Marks the completion of the coroutine body.
+     */
+    auto return_void() const noexcept -> none;
+
+    /**
+     * @brief Captures the exception that escaped the coroutine body.
+     */
+    auto unhandled_exception() noexcept -> none;
+
+    /**
+     * @brief Generators cannot await.
+     */
+    template <typename TAwaitable>
+    auto await_transform(TAwaitable&& awaitable) -> std::suspend_never = delete;
+
+    /*-----------------------------------------------------------------------------------+--------*\
+    *| [public]: Accessors                                                               | PUBLIC |*
+    \*-----------------------------------------------------------------------------------+--------*/
+
+    /**
+     * @brief   Accessor for the most recently yielded value.
+     * @returns The most recently yielded value.
+     */
+    [[nodiscard]] auto getValue() const noexcept -> const T&;
+
+    /**
+     * @brief Rethrows the captured exception if there is one.
+     */
+    auto rethrowIfFailed() const -> none;
+
+  private:
+    /*----------------------------------------------------------------------------------+---------*\
+    *| [private]: Fields                                                                | PRIVATE |*
+    \*----------------------------------------------------------------------------------+---------*/
+
+    const T*           m_value{nullptr};
+    std::exception_ptr m_exception;
+  };
+
+  // NOLINTEND(readability-identifier-naming)
+} // namespace fn::Coroutine::_internal
+
+namespace fn::Coroutine
+{
+  /**
+   * @brief   A lazily evaluated coroutine that produces a sequence of values with `co_yield`.
+   * @details The generator is an input range; each increment of its iterator resumes the coroutine
+   *          up to the next `co_yield`. Yielded values are referenced in place rather than copied.
+   *          Exceptions escaping the coroutine body are rethrown from `begin` or the increment that
+   *          resumed it. Frames are allocated from a thread-local recycling pool instead of the
+   *          global heap.
+   * @tparam  T The type of the yielded values.
+   */
+  template <typename T>
+  class [[nodiscard]] Generator final
+  {
+  public:
+    // NOLINTBEGIN(readability-identifier-naming)
+
+    /**
+     * @brief The promise type looked up by the compiler.
+     */
+    using promise_type = _internal::GeneratorPromise<T>;
+
+    // NOLINTEND(readability-identifier-naming)
+
+    /**
+     * @brief An input iterator over the yielded values.
+     */
+    class Iterator final
+    {
+    public:
+      // NOLINTBEGIN(readability-identifier-naming)
+
+      using iterator_category = std::input_iterator_tag;
+      using difference_type   = ptrd;
+      using value_type        = T;
+      using reference         = const T&;
+      using pointer           = const T*;
+
+      // NOLINTEND(readability-identifier-naming)
+
+      /**
+       * @brief Constructs a past-the-end iterator.
+       */
+      Iterator() noexcept = default;
+
+      /**
+       * @brief Constructs an iterator over the given coroutine.
+       * @param handle The coroutine to iterate.
+       */
+      explicit Iterator(std::coroutine_handle<promise_type> handle) noexcept;
+
+      /**
+       * @brief   Accessor for the current value.
+       * @returns The current value.
+       */
+      [[nodiscard]] auto operator*() const noexcept -> reference;
+
+      /**
+       * @brief   Accessor for the current value.
+       * @returns A pointer to the current value.
+       */
+      [[nodiscard]] auto operator->() const noexcept -> pointer;
+
+      /**
+       * @brief   Resumes the coroutine up to its next value.
+       * @returns The reference to this iterator.
+       * @throws  Any exception that escaped the coroutine body.
+       */
+      auto operator++() -> Iterator&;
+
+      /**
+       * @brief  Resumes the coroutine up to its next value.
+       * @throws Any exception that escaped the coroutine body.
+       */
+      auto operator++(idef) -> none;
+
+      /**
+       * @brief   Checks whether the iterator reached the end of the sequence.
+       * @returns Whether the coroutine ran to completion.
+       */
+      [[nodiscard]] auto operator==(std::default_sentinel_t) const noexcept -> bln;
+
+    private:
+      std::coroutine_handle<promise_type> m_handle;
+    };
+
+    /*-----------------------------------------------------------------------------------+--------*\
+    *| [public]: Constructors                                                            | PUBLIC |*
+    \*-----------------------------------------------------------------------------------+--------*/
+
+    /**
+     * @brief Constructs a generator that owns the given coroutine.
+     * @param handle The coroutine to own.
+     */
+    explicit Generator(std::coroutine_handle<promise_type> handle) noexcept;
+
+    /**
+     * @brief Generators are not copyable.
+     */
+    Generator(const Generator& other) = delete;
+
+    /**
+     * @brief Constructs a generator by moving another generator.
+     * @param other Other generator to move from.
+     */
+    Generator(Generator&& other) noexcept;
+
+    /*-----------------------------------------------------------------------------------+--------*\
+    *| [public]: Destructor                                                              | PUBLIC |*
+    \*-----------------------------------------------------------------------------------+--------*/
+
+    /**
+     * @brief Destructs the generator and its coroutine frame.
+     */
+    ~Generator();
+
+    /*-----------------------------------------------------------------------------------+--------*\
+    *| [public]: Operators                                                               | PUBLIC |*
+    \*-----------------------------------------------------------------------------------+--------*/
+
+    /**
+     * @brief Generators are not copyable.
+     */
+    auto operator=(const Generator& other) -> Generator& = delete;
+
+    /**
+     * @brief   Assigns another generator to this generator by moving.
+     * @param   other The other generator to move from.
+     * @returns The reference to this generator.
+     */
+    auto operator=(Generator&& other) noexcept -> Generator&;
+
+    /*-----------------------------------------------------------------------------------+--------*\
+    *| [public]: Methods                                                                 | PUBLIC |*
+    \*-----------------------------------------------------------------------------------+--------*/
+
+    /**
+     * @brief   Starts the coroutine up to its first value.
+     * @returns An iterator to the first value.
+     * @throws  Any exception that escaped the coroutine body.
+     * @warning The sequence can only be traversed once.
+     */
+    [[nodiscard]] auto begin() -> Iterator;
+
+    /**
+     * @brief   Accessor for the end of the sequence.
+     * @returns The sentinel that marks the end of the sequence.
+     */
+    [[nodiscard]] auto end() const noexcept -> std::default_sentinel_t;
+
+  private:
+    /*----------------------------------------------------------------------------------+---------*\
+    *| [private]: Fields                                                                | PRIVATE |*
+    \*----------------------------------------------------------------------------------+---------*/
+
+    std::coroutine_handle<promise_type> m_handle;
+  };
+} // namespace fn::Coroutine
+
+/*------------------------------------------------------------------------------------------------*\
+*| <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<< Implementation >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>> |*
+\*------------------------------------------------------------------------------------------------*/
+
+namespace fn::Coroutine::_internal
+{
+  // NOLINTBEGIN(readability-identifier-naming)
+
+  /*-------------------------------------------------------------------------------------+--------*\
+  *| [public]: Operators                                                                 | PUBLIC |*
+  \*-------------------------------------------------------------------------------------+--------*/
+
+  template <typename T>
+  [[nodiscard]] auto GeneratorPromise<T>::operator new(const size bytes) -> void*
+  {
+    return FramePool::allocate(bytes);
+  }
+
+  template <typename T>
+  auto GeneratorPromise<T>::operator delete(void* const frame, const size bytes) noexcept -> none
+  {
+    FramePool::deallocate(frame, bytes);
+  }
+
+  /*-------------------------------------------------------------------------------------+--------*\
+  *| [public]: Methods                                                                   | PUBLIC |*
+  \*-------------------------------------------------------------------------------------+--------*/
+
+  template <typename T>
+  [[nodiscard]] auto GeneratorPromise<T>::get_return_object() noexcept -> Generator<T>
+  {
+    return Generator<T>{std::coroutine_handle<GeneratorPromise>::from_promise(*this)};
+  }
+
+  template <typename T>
+  [[nodiscard]] auto GeneratorPromise<T>::initial_suspend() const noexcept -> std::suspend_always
+  {
+    return {};
+  }
+
+  template <typename T>
+  [[nodiscard]] auto GeneratorPromise<T>::final_suspend() const noexcept -> std::suspend_always
+  {
+    return {};
+  }
+
+  template <typename T>
+  auto GeneratorPromise<T>::yield_value(const T& value) noexcept -> std::suspend_always
+  {
+    m_value = std::addressof(value);
+    return {};
+  }
+
+  template <typename T>
+  auto GeneratorPromise<T>::return_void() const noexcept -> none
+  {}
+
+  template <typename T>
+  auto GeneratorPromise<T>::unhandled_exception() noexcept -> none
+  {
+    m_exception = std::current_exception();
+  }
+
+  /*-------------------------------------------------------------------------------------+--------*\
+  *| [public]: Accessors                                                                 | PUBLIC |*
+  \*-------------------------------------------------------------------------------------+--------*/
+
+  template <typename T>
+  [[nodiscard]] auto GeneratorPromise<T>::getValue() const noexcept -> const T&
+  {
+    return *m_value;
+  }
+
+  template <typename T>
+  auto GeneratorPromise<T>::rethrowIfFailed() const -> none
+  {
+    if (m_exception)
+    {
+      std::rethrow_exception(m_exception);
+    }
+  }
+
+  // NOLINTEND(readability-identifier-naming)
+} // namespace fn::Coroutine::_internal
+
+namespace fn::Coroutine
+{
+  /*-------------------------------------------------------------------------------------+--------*\
+  *| [public]: Iterator                                                                  | PUBLIC |*
+  \*-------------------------------------------------------------------------------------+--------*/
+
+  template <typename T>
+  Generator<T>::Iterator::Iterator(const std::coroutine_handle<promise_type> handle) noexcept
+    : m_handle{handle}
+  {}
+
+  template <typename T>
+  [[nodiscard]] auto Generator<T>::Iterator::operator*() const noexcept -> reference
+  {
+    return m_handle.promise().getValue();
+  }
+
+  template <typename T>
+  [[nodiscard]] auto Generator<T>::Iterator::operator->() const noexcept -> pointer
+  {
+    return std::addressof(m_handle.promise().getValue());
+  }
+
+  template <typename T>
+  auto Generator<T>::Iterator::operator++() -> Iterator&
+  {
+    // Run the coroutine up to its next value
+    m_handle.resume();
+
+    // Propagate the failure of the coroutine body
+    if (m_handle.done())
+    {
+      m_handle.promise().rethrowIfFailed();
+    }
+
+    // Return the reference to this iterator
+    return *this;
+  }
+
+  template <typename T>
+  auto Generator<T>::Iterator::operator++(idef) -> none
+  {
+    ++*this;
+  }
+
+  template <typename T>
+  [[nodiscard]] auto Generator<T>::Iterator::operator==(std::default_sentinel_t) const noexcept
+    -> bln
+  {
+    return not m_handle or m_handle.done();
+  }
+
+  /*-------------------------------------------------------------------------------------+--------*\
+  *| [public]: Constructors                                                              | PUBLIC |*
+  \*-------------------------------------------------------------------------------------+--------*/
+
+  template <typename T>
+  Generator<T>::Generator(const std::coroutine_handle<promise_type> handle) noexcept
+    : m_handle{handle}
+  {}
+
+  template <typename T>
+  Generator<T>::Generator(Generator&& other) noexcept
+    : m_handle{std::exchange(other.m_handle, nullptr)}
+  {}
+
+  /*-------------------------------------------------------------------------------------+--------*\
+  *| [public]: Destructor                                                                | PUBLIC |*
+  \*-------------------------------------------------------------------------------------+--------*/
+
+  template <typename T>
+  Generator<T>::~Generator()
+  {
+    if (m_handle)
+    {
+      m_handle.destroy();
+    }
+  }
+
+  /*-------------------------------------------------------------------------------------+--------*\
+  *| [public]: Operators                                                                 | PUBLIC |*
+  \*-------------------------------------------------------------------------------------+--------*/
+
+  template <typename T>
+  auto Generator<T>::operator=(Generator&& other) noexcept -> Generator&
+  {
+    // Release the owned coroutine and take over the other one
+    if (this != &other)
+    {
+      if (m_handle)
+      {
+        m_handle.destroy();
+      }
+      m_handle = std::exchange(other.m_handle, nullptr);
+    }
+
+    // Return the reference to this generator
+    return *this;
+  }
+
+  /*-------------------------------------------------------------------------------------+--------*\
+  *| [public]: Methods                                                                   | PUBLIC |*
+  \*-------------------------------------------------------------------------------------+--------*/
+
+  template <typename T>
+  [[nodiscard]] auto Generator<T>::begin() -> Iterator
+  {
+    // Return past-the-end iterator if there is nothing to run
+    if (not m_handle)
+    {
+      return Iterator{};
+    }
+
+    // Run the coroutine up to its first value
+    Iterator iterator{m_handle};
+    if (not m_handle.done())
+    {
+      ++iterator;
+    }
+
+    // Return the iterator to the first value
+    return iterator;
+  }
+
+  template <typename T>
+  [[nodiscard]] auto Generator<T>::end() const noexcept -> std::default_sentinel_t
+  {
+    return std::default_sentinel;
+  }
+} // namespace fn::Coroutine
+
+/*------------------------------------------------------------------------------------------------*\
+*| <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<< Promotes >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>> |*
+\*------------------------------------------------------------------------------------------------*/
+
+// NOLINTBEGIN(misc-unused-using-decls)
+
+namespace fn
+{
+  /**
+   * @brief  A lazily evaluated coroutine that produces a sequence of values with `co_yield`.
+   * @tparam T The type of the yielded values.
+   */
+  template <typename T>
+  using generator = Coroutine::Generator<T>;
+} // namespace fn
+
+// NOLINTEND(misc-unused-using-decls)
@@ -0,0 +1,641 @@
+#pragma once
+
+#include "Foundation/Coroutine/_internal/FramePool.ipp"
+#include "Foundation/concepts.hpp"
+#include "Foundation/errors.hpp"
+#include "Foundation/types.hpp"
+#include "Foundation/utilities.hpp"
+
+#include <coroutine>
+#include <exception>
+#include <utility>
+
+namespace fn::Coroutine
+{
+  template <typename T>
+  class Task;
+} // namespace fn::Coroutine
+
+namespace fn::Coroutine::_internal
+{
+  // NOLINTBEGIN(readability-identifier-naming)
+
+  /**
+   * @brief The awaiter returned from `final_suspend` that transfers control to the awaiting
+   *        coroutine.
+   */
+  struct TaskFinalAwaiter
+  {
+    /**
+     * @brief   Never skips suspension, the frame is kept alive for the awaiting coroutine.
+     * @returns Always `false`.
+     */
+    [[nodiscard]] auto await_ready() const noexcept -> bln;
+
+    /**
+     * @brief   Transfers control to the continuation of the finished coroutine.
+     * @param   handle The handle of the finished coroutine.
+     * @tparam  TPromise The promise type of the finished coroutine.
+     * @returns The continuation to resume through symmetric transfer.
+     */
+    template <typename TPromise>
+    [[nodiscard]] auto await_suspend(std::coroutine_handle<TPromise> handle) const noexcept
+      -> std::coroutine_handle<>;
+
+    /**
+     * @brief Never called as the finished coroutine is not resumed again.
+     */
+    auto await_resume() const noexcept -> none;
+  };
+
+  /**
+   * @brief The common part of the promise of every `Task`.
+   */
+  class TaskPromiseBase
+  {
+  public:
+    /*-----------------------------------------------------------------------------------+--------*\
+    *| [public]: Operators                                                               | PUBLIC |*
+    \*-----------------------------------------------------------------------------------+--------*/
+
+    /**
+     * @brief   Allocates the coroutine frame from the frame pool.
+     * @param   bytes The size of the frame in bytes.
+     * @returns A pointer to the allocated frame.
+     */
+    [[nodiscard]] static auto operator new(size bytes) -> void*;
+
+    /**
+     * @brief Releases the coroutine frame to the frame pool.
+     * @param frame The frame to release.
+     * @param bytes The size of the frame in bytes.
+     */
+    static auto operator delete(void* frame, size bytes) noexcept -> none;
+
+    /*-----------------------------------------------------------------------------------+--------*\
+    *| [public]: Methods                                                                 | PUBLIC |*
+    \*-----------------------------------------------------------------------------------+--------*/
+
+    /**
+     * @brief   Suspends the coroutine on creation so that tasks are lazy.
+     * @returns An awaiter that always suspends.
+     */
+    [[nodiscard]] auto initial_suspend() const noexcept -> std::suspend_always;
+
+    /**
+     * @brief   Suspends the coroutine on completion and resumes its continuation.
+     * @returns An awaiter that transfers control to the continuation.
+     */
+    [[nodiscard]] auto final_suspend() const noexcept -> TaskFinalAwaiter;
+
+    /**
+     * @brief Captures the exception that escaped the coroutine body.
+     */
+    auto unhandled_exception() noexcept -> none;
+
+    /*-----------------------------------------------------------------------------------+--------*\
+    *| [public]: Accessors                                                               | PUBLIC |*
+    \*-----------------------------------------------------------------------------------+--------*/
+
+    /**
+     * @brief   Accessor for the coroutine to resume when this one completes.
+     * @returns The continuation, or a no-op coroutine if nothing awaits this one.
+     */
+    [[nodiscard]] auto getContinuation() const noexcept -> std::coroutine_handle<>;
+
+    /*-----------------------------------------------------------------------------------+--------*\
+    *| [public]: Mutators                                                                | PUBLIC |*
+    \*-----------------------------------------------------------------------------------+--------*/
+
+    /**
+     * @brief Mutator for the coroutine to resume when this one completes.
+     * @param continuation The awaiting coroutine.
+     */
+    auto setContinuation(std::coroutine_handle<> continuation) noexcept -> none;
+
+  protected:
+    /*--------------------------------------------------------------------------------+-----------*\
+    *| [protected]: Methods                                                           | PROTECTED |*
+    \*--------------------------------------------------------------------------------+-----------*/
+
+    /**
+     * @brief Rethrows the captured exception if there is one.
+     */
+    auto rethrowIfFailed() const -> none;
+
+  private:
+    /*----------------------------------------------------------------------------------+---------*\
+    *| [private]: Fields                                                                | PRIVATE |*
+    \*----------------------------------------------------------------------------------+---------*/
+
+    std::coroutine_handle<> m_continuation{std::noop_coroutine()};
+    std::exception_ptr      m_exception;
+  };
+
+  /**
+   * @brief  The promise of a `Task` that produces a value.
+   * @tparam T The type of the produced value.
+   */
+  template <typename T>
+  class TaskPromise final : public TaskPromiseBase
+  {
+  public:
+    /**
+     * @brief   Creates the task that owns this promise.
+     * @returns The task.
+     */
+    [[nodiscard]] auto get_return_object() noexcept -> Task<T>;
+
+    /**
+     * @brief  Stores the value produced by `co_return`.
+     * @param  value The produced value.
+     * @tparam TValue The type of the produced value.
+     */
+    template <typename TValue>
+    requires IsConstructibleFrom<T, TValue&&>
+    auto return_value(TValue&& value) -> none;
+
+    /**
+     * @brief   Takes the produced value out of the promise.
+     * @returns The produced value.
+     * @throws  StateError If the value was already taken.
+     * @throws  Any exception that escaped the coroutine body.
+     */
+    [[nodiscard]] auto result() -> T;
+
+  private:
+    opt<T> m_value;
+  };
+
+  /**
+   * @brief The promise of a `Task` that produces no value.
+   */
+  template <>
+  class TaskPromise<none> final : public TaskPromiseBase
+  {
+  public:
+    /**
+     * @brief   Creates the task that owns this promise.
+     * @returns The task.
+     */
+    [[nodiscard]] auto get_return_object() noexcept -> Task<none>;
+
+    /**
+     * @brief Marks the completion of the coroutine body.
+     */
+    auto return_void() const noexcept -> none;
+
+    /**
+     * @brief  Completes the await of the task.
+     * @throws Any exception that escaped the coroutine body.
+     */
+    auto result() const -> none;
+  };
+
+  // NOLINTEND(readability-identifier-naming)
+} // namespace fn::Coroutine::_internal
+
+namespace fn::Coroutine
+{
+  /**
+   * @brief   A lazily started coroutine that produces a single value when awaited.
+   * @details The coroutine does not run until the task is awaited with `co_await` or driven by
+   *          `syncWait`. When it completes, control is transferred directly to the awaiting
+   *          coroutine, so arbitrarily deep chains of awaited tasks run in constant stack space.
+   *          Exceptions escaping the coroutine body are rethrown from the `co_await` expression.
+   *          Frames are allocated from a thread-local recycling pool instead of the global heap.
+   * @tparam  T The type of the produced value, `none` for no value.
+   */
+  template <typename T = none>
+  class [[nodiscard]] Task final
+  {
+  public:
+    // NOLINTBEGIN(readability-identifier-naming)
+
+    /**
+     * @brief The promise type looked up by the compiler.
+     */
+    using promise_type = _internal::TaskPromise<T>;
+
+    // NOLINTEND(readability-identifier-naming)
+
+    /**
+     * @brief The awaiter returned from `co_await`.
+     */
+    class Awaiter final
+    {
+    public:
+      // NOLINTBEGIN(readability-identifier-naming)
+
+      /**
+       * @brief Constructs an awaiter for the given coroutine.
+       * @param handle The coroutine to await.
+       */
+      explicit Awaiter(std::coroutine_handle<promise_type> handle) noexcept;
+
+      /**
+       * @brief   Skips suspension if the awaited coroutine is already done.
+       * @returns Whether the awaited coroutine is already done.
+       */
+      [[nodiscard]] auto await_ready() const noexcept -> bln;
+
+      /**
+       * @brief   Records the awaiting coroutine and starts the awaited one.
+       * @param   awaiting The awaiting coroutine.
+       * @returns The awaited coroutine to resume through symmetric transfer.
+       */
+      [[nodiscard]] auto await_suspend(std::coroutine_handle<> awaiting) const noexcept
+        -> std::coroutine_handle<>;
+
+      /**
+       * @brief   Accessor for the result of the awaited coroutine.
+       * @returns The produced value.
+       * @throws  StateError If the task is empty or its value was already taken.
+       * @throws  Any exception that escaped the coroutine body.
+       */
+      auto await_resume() const -> T;
+
+      // NOLINTEND(readability-identifier-naming)
+
+    private:
+      std::coroutine_handle<promise_type> m_handle;
+    };
+
+    /*-----------------------------------------------------------------------------------+--------*\
+    *| [public]: Constructors                                                            | PUBLIC |*
+    \*-----------------------------------------------------------------------------------+--------*/
+
+    /**
+     * @brief Constructs a task that owns the given coroutine.
+     * @param handle The coroutine to own.
+     */
+    explicit Task(std::coroutine_handle<promise_type> handle) noexcept;
+
+    /**
+     * @brief Tasks are not copyable.
+     */
+    Task(const Task& other) = delete;
+
+    /**
+     * @brief Constructs a task by moving another task.
+     * @param other Other task to move from.
+     */
+    Task(Task&& other) noexcept;
+
+    /*-----------------------------------------------------------------------------------+--------*\
+    *| [public]: Destructor                                                              | PUBLIC |*
+    \*-----------------------------------------------------------------------------------+--------*/
+
+    /**
+     * @brief Destructs the task and its coroutine frame.
+     */
+    ~Task();
+
+    /*-----------------------------------------------------------------------------------+--------*\
+    *| [public]: Operators                                                               | PUBLIC |*
+    \*-----------------------------------------------------------------------------------+--------*/
+
+    /**
+     * @brief Tasks are not copyable.
+     */
+    auto operator=(const Task& other) -> Task& = delete;
+
+    /**
+     * @brief   Assigns another task to this task by moving.
+     * @param   other The other task to move from.
+     * @returns The reference to this task.
+     */
+    auto operator=(Task&& other) noexcept -> Task&;
+
+    /**
+     * @brief   Awaits the task.
+     * @returns The awaiter.
+     */
+    [[nodiscard]] auto operator co_await() const noexcept -> Awaiter;
+
+    /*-----------------------------------------------------------------------------------+--------*\
+    *| [public]: Accessors                                                               | PUBLIC |*
+    \*-----------------------------------------------------------------------------------+--------*/
+
+    /**
+     * @brief   Accessor for the completion state of the task.
+     * @returns Whether the coroutine ran to completion.
+     */
+    [[nodiscard]] auto isDone() const noexcept -> bln;
+
+  private:
+    /*----------------------------------------------------------------------------------+---------*\
+    *| [private]: Fields                                                                | PRIVATE |*
+    \*----------------------------------------------------------------------------------+---------*/
+
+    std::coroutine_handle<promise_type> m_handle;
+
+    /*----------------------------------------------------------------------------------+---------*\
+    *| [private]: Friends                                                               | PRIVATE |*
+    \*----------------------------------------------------------------------------------+---------*/
+
+    template <typename TResult>
+    friend auto syncWait(Task<TResult> task) -> TResult;
+  };
+
+  /**
+   * @brief   Runs a task on the calling thread and returns its result.
+   * @param   task The task to run.
+   * @tparam  T The type of the produced value.
+   * @returns The produced value.
+   * @throws  StateError If the task is empty or suspends without completing.
+   * @throws  Any exception that escaped the coroutine body.
+   * @note    Intended as the entry point from non-coroutine code; there is no executor to resume a
+   *          task that suspends on something other than another task.
+   */
+  template <typename T>
+  auto syncWait(Task<T> task) -> T;
+} // namespace fn::Coroutine
+
+/*------------------------------------------------------------------------------------------------*\
+*| <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<< Implementation >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>> |*
+\*------------------------------------------------------------------------------------------------*/
+
+namespace fn::Coroutine::_internal
+{
+  // NOLINTBEGIN(readability-identifier-naming)
+
+  /*-------------------------------------------------------------------------------------+--------*\
+  *| [public]: TaskFinalAwaiter                                                          | PUBLIC |*
+  \*-------------------------------------------------------------------------------------+--------*/
+
+  [[nodiscard]] inline auto TaskFinalAwaiter::await_ready() const noexcept -> bln
+  {
+    return false;
+  }
+
+  template <typename TPromise>
+  [[nodiscard]] auto TaskFinalAwaiter::await_suspend(std::coroutine_handle<TPromise> handle
+  ) const noexcept -> std::coroutine_handle<>
+  {
+    return handle.promise().getContinuation();
+  }
+
+  inline auto TaskFinalAwaiter::await_resume() const noexcept -> none {}
+
+  /*-------------------------------------------------------------------------------------+--------*\
+  *| [public]: TaskPromiseBase                                                           | PUBLIC |*
+  \*-------------------------------------------------------------------------------------+--------*/
+
+  [[nodiscard]] inline auto TaskPromiseBase::operator new(const size bytes) -> void*
+  {
+    return FramePool::allocate(bytes);
+  }
+
+  inline auto TaskPromiseBase::operator delete(void* const frame, const size bytes) noexcept
+    -> none
+  {
+    FramePool::deallocate(frame, bytes);
+  }
+
+  [[nodiscard]] inline auto TaskPromiseBase::initial_suspend() const noexcept
+    -> std::suspend_always
+  {
+    return {};
+  }
+
+  [[nodiscard]] inline auto TaskPromiseBase::final_suspend() const noexcept -> TaskFinalAwaiter
+  {
+    return {};
+  }
+
+  inline auto TaskPromiseBase::unhandled_exception() noexcept -> none
+  {
+    m_exception = std::current_exception();
+  }
+
+  [[nodiscard]] inline auto TaskPromiseBase::getContinuation() const noexcept
+    -> std::coroutine_handle<>
+  {
+    return m_continuation;
+  }
+
+  inline auto TaskPromiseBase::setContinuation(const std::coroutine_handle<> continuation) noexcept
+    -> none
+  {
+    m_continuation = continuation;
+  }
+
+  inline auto TaskPromiseBase::rethrowIfFailed() const -> none
+  {
+    if (m_exception)
+    {
+      std::rethrow_exception(m_exception);
+    }
+  }
+
+  /*-------------------------------------------------------------------------------------+--------*\
+  *| [public]: TaskPromise                                                               | PUBLIC |*
+  \*-------------------------------------------------------------------------------------+--------*/
+
+  template <typename T>
+  [[nodiscard]] auto TaskPromise<T>::get_return_object() noexcept -> Task<T>
+  {
+    return Task<T>{std::coroutine_handle<TaskPromise>::from_promise(*this)};
+  }
+
+  template <typename T>
+  template <typename TValue>
+  requires IsConstructibleFrom<T, TValue&&>
+  auto TaskPromise<T>::return_value(TValue&& value) -> none
+  {
+    m_value.emplace(std::forward<TValue>(value));
+  }
+
+  template <typename T>
+  [[nodiscard]] auto TaskPromise<T>::result() -> T
+  {
+    // Propagate the failure of the coroutine body
+    rethrowIfFailed();
+
+    // Throw error if the value was already handed over by an earlier await
+    if (not m_value.has_value())
+    {
+      throw StateError{"Task result already taken!"};
+    }
+
+    // Hand the value over to the awaiting coroutine
+    T value{std::move(*m_value)};
+    m_value.reset();
+    return value;
+  }
+
+  [[nodiscard]] inline auto TaskPromise<none>::get_return_object() noexcept -> Task<none>
+  {
+    return Task<none>{std::coroutine_handle<TaskPromise>::from_promise(*this)};
+  }
+
+  inline auto TaskPromise<none>::return_void() const noexcept -> none {}
+
+  inline auto TaskPromise<none>::result() const -> none
+  {
+    // Propagate the failure of the coroutine body
+    rethrowIfFailed();
+  }
+
+  // NOLINTEND(readability-identifier-naming)
+} // namespace fn::Coroutine::_internal
+
+namespace fn::Coroutine
+{
+  // NOLINTBEGIN(readability-identifier-naming)
+
+  /*-------------------------------------------------------------------------------------+--------*\
+  *| [public]: Awaiter                                                                   | PUBLIC |*
+  \*-------------------------------------------------------------------------------------+--------*/
+
+  template <typename T>
+  Task<T>::Awaiter::Awaiter(const std::coroutine_handle<promise_type> handle) noexcept
+    : m_handle{handle}
+  {}
+
+  template <typename T>
+  [[nodiscard]] auto Task<T>::Awaiter::await_ready() const noexcept -> bln
+  {
+    return not m_handle or m_handle.done();
+  }
+
+  template <typename T>
+  [[nodiscard]] auto Task<T>::Awaiter::await_suspend(const std::coroutine_handle<> awaiting
+  ) const noexcept -> std::coroutine_handle<>
+  {
+    // Resume the awaiting coroutine once the awaited one completes
+    m_handle.promise().setContinuation(awaiting);
+
+    // Start the awaited coroutine without growing the stack
+    return m_handle;
+  }
+
+  template <typename T>
+  auto Task<T>::Awaiter::await_resume() const -> T
+  {
+    // Throw error if there is nothing to await
+    if (not m_handle)
+    {
+      throw StateError{"Awaited an empty task!"};
+    }
+
+    // Return the result of the coroutine
+    return m_handle.promise().result();
+  }
+
+  // NOLINTEND(readability-identifier-naming)
+
+  /*-------------------------------------------------------------------------------------+--------*\
+  *| [public]: Constructors                                                              | PUBLIC |*
+  \*-------------------------------------------------------------------------------------+--------*/
+
+  template <typename T>
+  Task<T>::Task(const std::coroutine_handle<promise_type> handle) noexcept
+    : m_handle{handle}
+  {}
+
+  template <typename T>
+  Task<T>::Task(Task&& other) noexcept
+    : m_handle{std::exchange(other.m_handle, nullptr)}
+  {}
+
+  /*-------------------------------------------------------------------------------------+--------*\
+  *| [public]: Destructor                                                                | PUBLIC |*
+  \*-------------------------------------------------------------------------------------+--------*/
+
+  template <typename T>
+  Task<T>::~Task()
+  {
+    if (m_handle)
+    {
+      m_handle.destroy();
+    }
+  }
+
+  /*-------------------------------------------------------------------------------------+--------*\
+  *| [public]: Operators                                                                 | PUBLIC |*
+  \*-------------------------------------------------------------------------------------+--------*/
+
+  template <typename T>
+  auto Task<T>::operator=(Task&& other) noexcept -> Task&
+  {
+    // Release the owned coroutine and take over the other one
+    if (this != &other)
+    {
+      if (m_handle)
+      {
+        m_handle.destroy();
+      }
+      m_handle = std::exchange(other.m_handle, nullptr);
+    }
+
+    // Return the reference to this task
+    return *this;
+  }
+
+  template <typename T>
+  [[nodiscard]] auto Task<T>::operator co_await() const noexcept -> Awaiter
+  {
+    return Awaiter{m_handle};
+  }
+
+  /*-------------------------------------------------------------------------------------+--------*\
+  *| [public]: Accessors                                                                 | PUBLIC |*
+  \*-------------------------------------------------------------------------------------+--------*/
+
+  template <typename T>
+  [[nodiscard]] auto Task<T>::isDone() const noexcept -> bln
+  {
+    return m_handle and m_handle.done();
+  }
+
+  /*-------------------------------------------------------------------------------------+--------*\
+  *| [public]: Functions                                                                 | PUBLIC |*
+  \*-------------------------------------------------------------------------------------+--------*/
+
+  template <typename T>
+  auto syncWait(Task<T> task) -> T
+  {
+    // Throw error if there is nothing to run
+    if (not task.m_handle)
+    {
+      throw StateError{"Waited on an empty task!"};
+    }
+
+    // Run the coroutine until it completes or suspends
+    if (not task.m_handle.done())
+    {
+      task.m_handle.resume();
+    }
+
+    // Throw error if the coroutine is waiting on something other than a task
+    if (not task.m_handle.done())
+    {
+      throw StateError{"Task suspended without completion!"};
+    }
+
+    // Return the result of the coroutine
+    return task.m_handle.promise().result();
+  }
+} // namespace fn::Coroutine
+
+/*------------------------------------------------------------------------------------------------*\
+*| <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<< Promotes >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>> |*
+\*------------------------------------------------------------------------------------------------*/
+
+// NOLINTBEGIN(misc-unused-using-decls)
+
+namespace fn
+{
+  /**
+   * @brief  A lazily started coroutine that produces a single value when awaited.
+   * @tparam T The type of the produced value, `none` for no value.
+   */
+  template <typename T = none>
+  using task = Coroutine::Task<T>;
+
+  using Coroutine::syncWait;
+} // namespace fn
+
+// NOLINTEND(misc-unused-using-decls)
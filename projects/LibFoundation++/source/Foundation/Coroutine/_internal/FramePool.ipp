@@ -0,0 +1,229 @@
+#pragma once
+
+#include "Foundation/containers.hpp"
+#include "Foundation/types.hpp"
+
+#include <new>
+
+namespace fn::Coroutine::_internal
+{
+  /**
+   * @brief   A thread-local recycling pool for coroutine frames.
+   * @details Frames are grouped into size classes of `GRANULARITY` bytes. Released frames are kept
+   *          on a per-thread free list of their size class and handed out again on the next
+   *          allocation of the same class, so steady-state coroutine creation never reaches the
+   *          global allocator. Frames larger than `MAX_POOLED_SIZE` bypass the pool.
+   * @note    A frame may be released on a different thread than the one that allocated it; it is
+   *          then recycled by the releasing thread. Frames released during thread teardown, after
+   *          the free lists of the thread are gone, go straight to the global allocator.
+   */
+  class FramePool final
+  {
+  public:
+    /*-----------------------------------------------------------------------------------+--------*\
+    *| [public]: Constants                                                               | PUBLIC |*
+    \*-----------------------------------------------------------------------------------+--------*/
+
+    /**
+     * @brief The size class granularity in bytes.
+     */
+    static constexpr size GRANULARITY{64};
+
+    /**
+     * @brief The largest frame size in bytes that is served from the pool.
+     */
+    static constexpr size MAX_POOLED_SIZE{2'048};
+
+    /**
+     * @brief The maximum number of frames retained per size class and thread.
+     */
+    static constexpr size MAX_RETAINED_FRAMES{256};
+
+    /*-----------------------------------------------------------------------------------+--------*\
+    *| [public]: Methods                                                                 | PUBLIC |*
+    \*-----------------------------------------------------------------------------------+--------*/
+
+    /**
+     * @brief   Allocates a coroutine frame.
+     * @param   bytes The size of the frame in bytes.
+     * @returns A pointer to the allocated frame.
+     * @throws  std::bad_alloc If the global allocator fails.
+     */
+    [[nodiscard]] static auto allocate(size bytes) -> void*;
+
+    /**
+     * @brief Releases a coroutine frame previously obtained from `allocate`.
+     * @param frame The frame to release.
+     * @param bytes The size of the frame in bytes, as passed to `allocate`.
+     */
+    static auto deallocate(void* frame, size bytes) noexcept -> none;
+
+  private:
+    /*----------------------------------------------------------------------------------+---------*\
+    *| [private]: Types                                                                 | PRIVATE |*
+    \*----------------------------------------------------------------------------------+---------*/
+
+    /**
+     * @brief An intrusive node stored inside a released frame.
+     */
+    struct Node
+    {
+      Node* next;
+    };
+
+    /**
+     * @brief A singly linked list of released frames of one size class.
+     */
+    struct FreeList
+    {
+      Node* head{nullptr};
+      size  count{0};
+    };
+
+    /**
+     * @brief The per-thread set of free lists that returns its frames on thread exit.
+     */
+    struct Lists
+    {
+      arr<FreeList, MAX_POOLED_SIZE / GRANULARITY> classes{};
+
+      Lists() = default;
+
+      Lists(const Lists&) = delete;
+
+      Lists(Lists&&) = delete;
+
+      ~Lists();
+
+      auto operator=(const Lists&) -> Lists& = delete;
+
+      auto operator=(Lists&&) -> Lists& = delete;
+    };
+
+    /*----------------------------------------------------------------------------------+---------*\
+    *| [private]: Methods                                                               | PRIVATE |*
+    \*----------------------------------------------------------------------------------+---------*/
+
+    /**
+     * @brief   Accessor for the free lists of the calling thread.
+     * @returns The free lists of the calling thread, or `nullptr` once they have been destroyed.
+     */
+    [[nodiscard]] static auto lists() noexcept -> Lists*;
+
+    /**
+     * @brief   Accessor for whether the free lists of the calling thread have been destroyed.
+     * @returns The flag of the calling thread, which is trivially destructible and thus outlives
+     *          the free lists.
+     */
+    [[nodiscard]] static auto isTornDown() noexcept -> bln&;
+  };
+} // namespace fn::Coroutine::_internal
+
+/*------------------------------------------------------------------------------------------------*\
+*| <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<< Implementation >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>> |*
+\*------------------------------------------------------------------------------------------------*/
+
+namespace fn::Coroutine::_internal
+{
+  /*-------------------------------------------------------------------------------------+--------*\
+  *| [public]: Methods                                                                   | PUBLIC |*
+  \*-------------------------------------------------------------------------------------+--------*/
+
+  [[nodiscard]] inline auto FramePool::allocate(const size bytes) -> void*
+  {
+    // Bypass the pool for oversized frames
+    if (bytes == 0 or bytes > MAX_POOLED_SIZE)
+    {
+      return ::operator new(bytes);
+    }
+
+    // Fall back to the global allocator once the free lists are gone
+    const size   sizeClass{(bytes - 1) / GRANULARITY};
+    Lists* const pool{lists()};
+    if (pool == nullptr)
+    {
+      return ::operator new((sizeClass + 1) * GRANULARITY);
+    }
+
+    // Pop a recycled frame of the same size class if available
+    if (FreeList& list{pool->classes.at(sizeClass)}; list.head != nullptr)
+    {
+      Node* const node{list.head};
+      list.head = node->next;
+      --list.count;
+      return node;
+    }
+
+    // Allocate a new frame rounded up to its size class
+    return ::operator new((sizeClass + 1) * GRANULARITY);
+  }
+
+  inline auto FramePool::deallocate(void* const frame, const size bytes) noexcept -> none
+  {
+    // Bypass the pool for oversized frames
+    if (bytes == 0 or bytes > MAX_POOLED_SIZE)
+    {
+      ::operator delete(frame);
+      return;
+    }
+
+    // Release the frame to the global allocator once the free lists are gone
+    Lists* const pool{lists()};
+    if (pool == nullptr)
+    {
+      ::operator delete(frame);
+      return;
+    }
+
+    // Release the frame to the global allocator if the size class is saturated
+    FreeList& list{pool->classes.at((bytes - 1) / GRANULARITY)};
+    if (list.count >= MAX_RETAINED_FRAMES)
+    {
+      ::operator delete(frame);
+      return;
+    }
+
+    // Push the frame onto the free list
+    list.head = ::new (frame) Node{list.head};
+    ++list.count;
+  }
+
+  /*------------------------------------------------------------------------------------+---------*\
+  *| [private]: Methods                                                                 | PRIVATE |*
+  \*------------------------------------------------------------------------------------+---------*/
+
+  [[nodiscard]] inline auto FramePool::lists() noexcept -> Lists*
+  {
+    // Refuse to resurrect the free lists during thread teardown
+    if (isTornDown())
+    {
+      return nullptr;
+    }
+
+    thread_local Lists s_lists;
+    return &s_lists;
+  }
+
+  [[nodiscard]] inline auto FramePool::isTornDown() noexcept -> bln&
+  {
+    thread_local bln s_isTornDown{false};
+    return s_isTornDown;
+  }
+
+  inline FramePool::Lists::~Lists()
+  {
+    // Route later releases of this thread around the destroyed free lists
+    isTornDown() = true;
+
+    // Return every retained frame to the global allocator
+    for (FreeList& list : classes)
+    {
+      while (list.head != nullptr)
+      {
+        Node* const node{list.head};
+        list.head = node->next;
+        ::operator delete(node);
+      }
+    }
+  }
+} // namespace fn::Coroutine::_internal
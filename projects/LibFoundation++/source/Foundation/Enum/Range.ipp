@@ -0,0 +1,40 @@
+#pragma once
+
+#include "Foundation/Enum/_internal/concepts.hpp"
+#include "Foundation/concepts.hpp"
+#include "Foundation/types.hpp"
+
+#include <type_traits>
+
+namespace fn::Enum
+{
+  /**
+   * @brief   The range of values scanned for enumerators when reflecting an enumeration.
+   * @details Covers `[-128, 127]` for enumerations with a signed underlying type and `[0, 255]`
+   *          otherwise. Specialize this template to reflect enumerators outside of these values or
+   *          to reduce the compile-time cost of a small enumeration. The range is clamped to the
+   *          values of the underlying type.
+   * @tparam  E The enumeration.
+   * @warning An unscoped enumeration without a fixed underlying type can only represent the values
+   *          of its smallest bit-field, so it has no default range and must specialize this
+   *          template with a range that does not exceed those values.
+   */
+  template <IsEnum E>
+  struct Range
+  {
+    static_assert(
+      _internal::HasFixedUnderlyingType<E>,
+      "Specialize fn::Enum::Range for an enumeration without a fixed underlying type!"
+    );
+
+    /**
+     * @brief The smallest value scanned.
+     */
+    static constexpr i64 MIN{IsSigned<std::underlying_type_t<E>> ? -128 : 0};
+
+    /**
+     * @brief The largest value scanned.
+     */
+    static constexpr i64 MAX{IsSigned<std::underlying_type_t<E>> ? 127 : 255};
+  };
+} // namespace fn::Enum
@@ -0,0 +1,405 @@
+#pragma once
+
+#include "Foundation/Enum/Range.ipp"
+#include "Foundation/concepts.hpp"
+#include "Foundation/constants.hpp"
+#include "Foundation/containers.hpp"
+#include "Foundation/types.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+namespace fn::Enum::_internal
+{
+  /**
+   * @brief   Obtains the compiler-generated signature of a function instantiated for a value.
+   * @tparam  value The value.
+   * @returns The signature, which spells the value as the enumerator name if it has one.
+   */
+  template <auto value>
+  [[nodiscard]] consteval auto getSignature() noexcept -> strv;
+
+  /**
+   * @brief   Extracts the enumerator name from a signature produced by `getSignature`.
+   * @param   signature The signature.
+   * @returns The unqualified enumerator name, or an empty view if the value has no name.
+   */
+  [[nodiscard]] consteval auto extractName(strv signature) noexcept -> strv;
+
+  /**
+   * @brief   Extracts the names of consecutive values of an enumeration from their signatures.
+   * @tparam  E The enumeration.
+   * @tparam  min The first value.
+   * @tparam  offsets The offsets of the values from the first value.
+   * @returns The names, which view the signatures and must not outlive constant evaluation.
+   */
+  template <IsEnum E, i64 min, size... offsets>
+  [[nodiscard]] consteval auto getSpelledNames(std::index_sequence<offsets...>) noexcept
+    -> arr<strv, sizeof...(offsets)>;
+
+  /**
+   * @brief   Hashes an enumerator name.
+   * @param   name The name.
+   * @returns The hash of the name.
+   */
+  [[nodiscard]] constexpr auto hashName(strv name) noexcept -> u64;
+
+  /**
+   * @brief   Selects the slot of a hashed name for a displacement of its bucket.
+   * @param   hash The hash of the name.
+   * @param   displacement The displacement of the bucket of the name.
+   * @param   mask The slot count minus one.
+   * @returns The index of the slot.
+   */
+  [[nodiscard]] constexpr auto getSlot(u64 hash, u32 displacement, size mask) noexcept -> size;
+
+  /**
+   * @brief   The compile-time reflection tables of an enumeration.
+   * @details `NAMES` maps every scanned value to its enumerator name by array index. Parsing goes
+   *          through a minimal-probe perfect hash built with hash-and-displace: every name falls
+   *          into a bucket whose displacement sends it to a slot of its own, so a lookup costs one
+   *          hash, two table reads and one string comparison.
+   * @tparam  E The enumeration.
+   */
+  template <IsEnum E>
+  struct Table
+  {
+    /*-----------------------------------------------------------------------------------+--------*\
+    *| [public]: Types                                                                   | PUBLIC |*
+    \*-----------------------------------------------------------------------------------+--------*/
+
+    using Underlying = std::underlying_type_t<E>;
+
+    /*-----------------------------------------------------------------------------------+--------*\
+    *| [public]: Constants                                                               | PUBLIC |*
+    \*-----------------------------------------------------------------------------------+--------*/
+
+    /**
+     * @brief The smallest scanned value.
+     */
+    static constexpr i64 MIN{
+      IsSigned<Underlying>
+        ? std::max<i64>(Range<E>::MIN, std::numeric_limits<Underlying>::min())
+        : std::max<i64>(Range<E>::MIN, 0)
+    };
+
+    /**
+     * @brief The largest scanned value.
+     */
+    static constexpr i64 MAX{
+      sizeof(Underlying) < sizeof(i64)
+        ? std::min<i64>(Range<E>::MAX, static_cast<i64>(std::numeric_limits<Underlying>::max()))
+        : Range<E>::MAX
+    };
+
+    static_assert(MIN <= MAX, "The range of the enumeration is empty!");
+
+    /**
+     * @brief The number of scanned values.
+     */
+    static constexpr size SCANNED_COUNT{static_cast<size>(MAX - MIN + 1)};
+
+    /**
+     * @brief The number of characters of all names.
+     */
+    static constexpr size CHARACTER_COUNT{[]
+    {
+      size count{0};
+      for (const strv name : getSpelledNames<E, MIN>(std::make_index_sequence<SCANNED_COUNT>{}))
+      {
+        count += name.size();
+      }
+      return count;
+    }()};
+
+    /**
+     * @brief The characters of all names, copied out of the signatures they were extracted from.
+     */
+    static constexpr auto CHARACTERS{[]
+    {
+      arr<cdef, std::max<size>(CHARACTER_COUNT, 1)> characters{};
+      auto                                          cursor{characters.begin()};
+      for (const strv name : getSpelledNames<E, MIN>(std::make_index_sequence<SCANNED_COUNT>{}))
+      {
+        cursor = std::ranges::copy(name, cursor).out;
+      }
+      return characters;
+    }()};
+
+    /**
+     * @brief The names of the scanned values, empty for values without a name.
+     */
+    static constexpr auto NAMES{[]
+    {
+      const strv               characters{CHARACTERS.data(), CHARACTER_COUNT};
+      arr<strv, SCANNED_COUNT> names{};
+      size                     offset{0};
+      for (size index{0};
+           const strv name : getSpelledNames<E, MIN>(std::make_index_sequence<SCANNED_COUNT>{}))
+      {
+        names.at(index++) = characters.substr(offset, name.size());
+        offset += name.size();
+      }
+      return names;
+    }()};
+
+    /**
+     * @brief The number of named values.
+     */
+    static constexpr size COUNT{static_cast<size>(std::ranges::count_if(
+      NAMES,
+      [](const strv name)
+      {
+        return not name.empty();
+      }
+    ))};
+
+    /**
+     * @brief The number of slots of the perfect hash, a power of two of at least twice the count.
+     */
+    static constexpr size SLOT_COUNT{std::bit_ceil(std::max<size>(COUNT, 1)) * 2};
+
+    /**
+     * @brief The number of buckets of the perfect hash.
+     */
+    static constexpr size BUCKET_COUNT{std::max<size>(COUNT / 2, 1)};
+
+    /**
+     * @brief The number of displacements tried per bucket before the perfect hash gives up.
+     */
+    static constexpr u32 MAX_DISPLACEMENT{1U << 16U};
+
+    /**
+     * @brief The perfect hash of the names.
+     */
+    static constexpr auto HASH{
+      []
+      {
+        struct
+        {
+          arr<u32, BUCKET_COUNT> displacements{};
+          arr<u32, SLOT_COUNT>   slots{};
+          bln                    isPerfect{true};
+        } hash;
+
+        // Group the names into buckets
+        vec<vec<u32>> buckets(BUCKET_COUNT);
+        for (size index{0}; index < NAMES.size(); ++index)
+        {
+          if (not NAMES.at(index).empty())
+          {
+            buckets.at((hashName(NAMES.at(index)) >> 32U) % BUCKET_COUNT)
+              .push_back(static_cast<u32>(index));
+          }
+        }
+
+        // Place the largest buckets first while most slots are still free
+        vec<u32> order(BUCKET_COUNT);
+        for (size bucket{0}; bucket < BUCKET_COUNT; ++bucket)
+        {
+          order.at(bucket) = static_cast<u32>(bucket);
+        }
+        std::ranges::sort(
+          order,
+          [&buckets](const u32 lhs, const u32 rhs)
+          {
+            return buckets.at(lhs).size() > buckets.at(rhs).size();
+          }
+        );
+
+        // Find a displacement per bucket that sends every name to a free slot of its own
+        for (const u32 bucket : order)
+        {
+          u32 displacement{0};
+          for (; displacement < MAX_DISPLACEMENT; ++displacement)
+          {
+            vec<size> slots;
+            for (const u32 index : buckets.at(bucket))
+            {
+              const size slot{getSlot(hashName(NAMES.at(index)), displacement, SLOT_COUNT - 1)};
+              if (hash.slots.at(slot) != 0 or std::ranges::find(slots, slot) != slots.end())
+              {
+                break;
+              }
+              slots.push_back(slot);
+            }
+
+            // Claim the slots once every name of the bucket fits
+            if (slots.size() == buckets.at(bucket).size())
+            {
+              for (size name{0}; name < slots.size(); ++name)
+              {
+                hash.slots.at(slots.at(name)) = buckets.at(bucket).at(name) + 1;
+              }
+              hash.displacements.at(bucket) = displacement;
+              break;
+            }
+          }
+
+          // Give up on names that collide for every displacement
+          if (displacement == MAX_DISPLACEMENT)
+          {
+            hash.isPerfect = false;
+            break;
+          }
+        }
+
+        // Return the perfect hash
+        return hash;
+      }()
+    };
+
+    static_assert(HASH.isPerfect, "Cannot build a perfect hash of the enumerator names!");
+
+    /*-----------------------------------------------------------------------------------+--------*\
+    *| [public]: Methods                                                                 | PUBLIC |*
+    \*-----------------------------------------------------------------------------------+--------*/
+
+    /**
+     * @brief   Looks up the name of a value.
+     * @param   value The value.
+     * @returns The name, or an empty view if the value is out of range or has no name.
+     */
+    [[nodiscard]] static constexpr auto findName(E value) noexcept -> strv;
+
+    /**
+     * @brief   Looks up the value of a name.
+     * @param   name The name.
+     * @returns The value, or `nopt` if no enumerator has the name.
+     */
+    [[nodiscard]] static constexpr auto findValue(strv name) noexcept -> opt<E>;
+  };
+} // namespace fn::Enum::_internal
+
+/*------------------------------------------------------------------------------------------------*\
+*| <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<< Implementation >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>> |*
+\*------------------------------------------------------------------------------------------------*/
+
+namespace fn::Enum::_internal
+{
+  // NOLINTBEGIN(cppcoreguidelines-pro-bounds-constant-array-index)
+
+  template <auto value>
+  [[nodiscard]] consteval auto getSignature() noexcept -> strv
+  {
+#if defined(_MSC_VER) and not defined(__clang__)
+    return __FUNCSIG__;
+#else
+    return __PRETTY_FUNCTION__;
+#endif
+  }
+
+  [[nodiscard]] consteval auto extractName(const strv signature) noexcept -> strv
+  {
+    constexpr strv GNU_PREFIX{"value = "};
+
+    // Isolate the spelling of the value, as in `[with auto value = E::NAME]` or `<E::NAME>(void)`
+    strv spelling{signature};
+    if (const size start{signature.find(GNU_PREFIX)}; start != strv::npos)
+    {
+      spelling = signature.substr(start + GNU_PREFIX.size());
+      spelling = spelling.substr(0, spelling.find_first_of(";]"));
+    }
+    else
+    {
+      spelling = signature.substr(0, signature.rfind(">("));
+      spelling = spelling.substr(spelling.rfind('<') + 1);
+    }
+
+    // Strip the qualification
+    if (const size colon{spelling.rfind("::")}; colon != strv::npos)
+    {
+      spelling = spelling.substr(colon + 2);
+    }
+
+    // Return nothing for casts such as `(E)5` or `0x5`, which spell values without a name
+    const bln isIdentifier{std::ranges::all_of(
+      spelling,
+      [](const cdef character)
+      {
+        return (character >= 'a' and character <= 'z') or (character >= 'A' and character <= 'Z')
+            or (character >= '0' and character <= '9') or character == '_';
+      }
+    )};
+    if (spelling.empty() or not isIdentifier
+        or (spelling.front() >= '0' and spelling.front() <= '9'))
+    {
+      return {};
+    }
+
+    // Return the name
+    return spelling;
+  }
+
+  template <IsEnum E, i64 min, size... offsets>
+  [[nodiscard]] consteval auto getSpelledNames(std::index_sequence<offsets...>) noexcept
+    -> arr<strv, sizeof...(offsets)>
+  {
+    return {extractName(getSignature<static_cast<E>(min + static_cast<i64>(offsets))>())...};
+  }
+
+  [[nodiscard]] constexpr auto hashName(const strv name) noexcept -> u64
+  {
+    // Apply FNV-1a over the characters
+    u64 hash{0xCB'F2'9C'E4'84'22'23'25};
+    for (const cdef character : name)
+    {
+      hash = (hash ^ static_cast<u8>(character)) * 0x00'00'01'00'00'00'01'B3;
+    }
+
+    // Avalanche the state, as FNV-1a leaves short names clustered
+    hash ^= hash >> 33U;
+    hash *= 0xFF'51'AF'D7'ED'55'8C'CD;
+    hash ^= hash >> 33U;
+    return hash;
+  }
+
+  [[nodiscard]] constexpr auto getSlot(
+    const u64 hash, const u32 displacement, const size mask
+  ) noexcept -> size
+  {
+    // Scramble the hash with the displacement
+    u64 value{hash ^ (displacement * 0x9E'37'79'B9'7F'4A'7C'15)};
+    value ^= value >> 29U;
+    value *= 0xBF'58'47'6D'1C'E4'E5'B9;
+    value ^= value >> 32U;
+    return static_cast<size>(value) & mask;
+  }
+
+  template <IsEnum E>
+  [[nodiscard]] constexpr auto Table<E>::findName(const E value) noexcept -> strv
+  {
+    // Return nothing if the value is out of range
+    const auto number{static_cast<i64>(static_cast<Underlying>(value))};
+    if (number < MIN or number > MAX)
+    {
+      return {};
+    }
+
+    // Return the name by index
+    return NAMES[static_cast<size>(number - MIN)];
+  }
+
+  template <IsEnum E>
+  [[nodiscard]] constexpr auto Table<E>::findValue(const strv name) noexcept -> opt<E>
+  {
+    // Find the only slot the name can occupy
+    const u64 hash{hashName(name)};
+    const u32 displacement{HASH.displacements[(hash >> 32U) % BUCKET_COUNT]};
+    const u32 slot{HASH.slots[getSlot(hash, displacement, SLOT_COUNT - 1)]};
+
+    // Return nothing if the slot is empty or holds another name
+    if (slot == 0 or NAMES[slot - 1] != name)
+    {
+      return nopt;
+    }
+
+    // Return the value of the slot
+    return static_cast<E>(MIN + static_cast<i64>(slot - 1));
+  }
+
+  // NOLINTEND(cppcoreguidelines-pro-bounds-constant-array-index)
+} // namespace fn::Enum::_internal
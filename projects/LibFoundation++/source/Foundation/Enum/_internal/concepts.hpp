@@ -0,0 +1,16 @@
+#pragma once
+
+#include "Foundation/concepts.hpp"
+
+#include <type_traits>
+
+namespace fn::Enum::_internal
+{
+  /**
+   * @brief  Concept to check if an enumeration has a fixed underlying type.
+   * @remark Only such enumerations can be list-initialized from a value of their underlying type,
+   *         and only they can hold every value of it.
+   */
+  template <typename E>
+  concept HasFixedUnderlyingType = IsEnum<E> and requires { E{std::underlying_type_t<E>{}}; };
+} // namespace fn::Enum::_internal
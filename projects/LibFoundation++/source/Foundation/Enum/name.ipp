@@ -0,0 +1,73 @@
+#pragma once
+
+#include "Foundation/Enum/_internal/Table.ipp"
+#include "Foundation/concepts.hpp"
+#include "Foundation/constants.hpp"
+#include "Foundation/errors.hpp"
+#include "Foundation/types.hpp"
+
+#include <string>
+#include <type_traits>
+
+namespace fn::Enum
+{
+  /**
+   * @brief   Obtains the name of an enumerator in constant time.
+   * @details The names are reflected at compile time from the values in `Range<E>` and looked up by
+   *          array index.
+   * @param   value The enumerator.
+   * @tparam  E The enumeration.
+   * @returns The unqualified name of the enumerator.
+   * @throws  EnumeratorError If the value is outside of `Range<E>` or has no name.
+   * @note    Of several enumerators with the same value, the compiler picks the name.
+   */
+  template <IsEnum E>
+  [[nodiscard]] constexpr auto name(E value) -> strv;
+
+  /**
+   * @brief   Obtains the name of an enumerator in constant time without exceptions.
+   * @param   value The enumerator.
+   * @tparam  E The enumeration.
+   * @returns The unqualified name of the enumerator, or `nopt` if the value has no name.
+   * @see     `name` for the reflected values.
+   */
+  template <IsEnum E>
+  [[nodiscard]] constexpr auto tryName(E value) noexcept -> opt<strv>;
+} // namespace fn::Enum
+
+/*------------------------------------------------------------------------------------------------*\
+*| <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<< Implementation >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>> |*
+\*------------------------------------------------------------------------------------------------*/
+
+namespace fn::Enum
+{
+  template <IsEnum E>
+  [[nodiscard]] constexpr auto name(const E value) -> strv
+  {
+    // Throw error if the value has no name
+    const strv text{_internal::Table<E>::findName(value)};
+    if (text.empty())
+    {
+      throw EnumeratorError{
+        "Unnamed enumerator!", std::to_string(static_cast<std::underlying_type_t<E>>(value))
+      };
+    }
+
+    // Return the name
+    return text;
+  }
+
+  template <IsEnum E>
+  [[nodiscard]] constexpr auto tryName(const E value) noexcept -> opt<strv>
+  {
+    // Return nothing if the value has no name
+    const strv text{_internal::Table<E>::findName(value)};
+    if (text.empty())
+    {
+      return nopt;
+    }
+
+    // Return the name
+    return text;
+  }
+} // namespace fn::Enum
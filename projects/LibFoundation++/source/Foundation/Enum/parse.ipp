@@ -0,0 +1,59 @@
+#pragma once
+
+#include "Foundation/Enum/_internal/Table.ipp"
+#include "Foundation/concepts.hpp"
+#include "Foundation/errors.hpp"
+#include "Foundation/types.hpp"
+
+namespace fn::Enum
+{
+  /**
+   * @brief   Parses an enumerator from its name in constant time.
+   * @details The names are reflected at compile time from the values in `Range<E>` and looked up
+   *          through a perfect hash, so parsing costs one hash and one string comparison regardless
+   *          of the number of enumerators.
+   * @param   text The unqualified, case-sensitive name of the enumerator.
+   * @tparam  E The enumeration.
+   * @returns The enumerator.
+   * @throws  EnumeratorError If no enumerator of `E` has the name.
+   */
+  template <IsEnum E>
+  [[nodiscard]] constexpr auto parse(strv text) -> E;
+
+  /**
+   * @brief   Parses an enumerator from its name in constant time without exceptions.
+   * @param   text The unqualified, case-sensitive name of the enumerator.
+   * @tparam  E The enumeration.
+   * @returns The enumerator, or `nopt` if no enumerator of `E` has the name.
+   * @see     `parse` for the reflected names.
+   */
+  template <IsEnum E>
+  [[nodiscard]] constexpr auto tryParse(strv text) noexcept -> opt<E>;
+} // namespace fn::Enum
+
+/*------------------------------------------------------------------------------------------------*\
+*| <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<< Implementation >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>> |*
+\*------------------------------------------------------------------------------------------------*/
+
+namespace fn::Enum
+{
+  template <IsEnum E>
+  [[nodiscard]] constexpr auto parse(const strv text) -> E
+  {
+    // Throw error if no enumerator has the name
+    const opt<E> value{_internal::Table<E>::findValue(text)};
+    if (not value.has_value())
+    {
+      throw EnumeratorError{"Unknown enumerator!", str{text}};
+    }
+
+    // Return the enumerator
+    return value.value();
+  }
+
+  template <IsEnum E>
+  [[nodiscard]] constexpr auto tryParse(const strv text) noexcept -> opt<E>
+  {
+    return _internal::Table<E>::findValue(text);
+  }
+} // namespace fn::Enum
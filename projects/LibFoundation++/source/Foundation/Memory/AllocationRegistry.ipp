@@ -0,0 +1,125 @@
+#pragma once
+
+#include "Foundation/Memory/AllocationStatistics.ipp"
+#include "Foundation/Memory/_internal/AllocationLedger.ipp"
+#include "Foundation/Memory/_internal/concepts.hpp"
+#include "Foundation/containers.hpp"
+#include "Foundation/types.hpp"
+
+#include <iomanip>
+#include <iostream>
+#include <ostream>
+
+namespace fn::Memory
+{
+  /**
+   * @brief The registry of the statistics of every tag used by a tracking allocator.
+   * @note  Tags appear in the registry once a tracking allocator of the tag records an allocation.
+   */
+  class AllocationRegistry final
+  {
+  public:
+    /*-----------------------------------------------------------------------------------+--------*\
+    *| [public]: Methods                                                                 | PUBLIC |*
+    \*-----------------------------------------------------------------------------------+--------*/
+
+    /**
+     * @brief   Takes a snapshot of the statistics of one tag.
+     * @tparam  TTag The tag.
+     * @returns The statistics of the tag, or empty statistics if tracking is disabled.
+     */
+    template <_internal::IsAllocationTag TTag>
+    [[nodiscard]] static auto getStatistics() -> AllocationStatistics;
+
+    /**
+     * @brief   Takes a snapshot of the statistics of every tag.
+     * @returns The statistics of every tag, or nothing if tracking is disabled.
+     */
+    [[nodiscard]] static auto getStatistics() -> vec<AllocationStatistics>;
+
+    /**
+     * @brief Prints a summary of the statistics of every tag.
+     * @param os The output stream.
+     */
+    static auto dump(std::ostream& os = std::cerr) -> none;
+  };
+} // namespace fn::Memory
+
+/*------------------------------------------------------------------------------------------------*\
+*| <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<< Implementation >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>> |*
+\*------------------------------------------------------------------------------------------------*/
+
+namespace fn::Memory
+{
+  /*-------------------------------------------------------------------------------------+--------*\
+  *| [public]: Methods                                                                   | PUBLIC |*
+  \*-------------------------------------------------------------------------------------+--------*/
+
+  template <_internal::IsAllocationTag TTag>
+  [[nodiscard]] auto AllocationRegistry::getStatistics() -> AllocationStatistics
+  {
+    // Return empty statistics if tracking is disabled
+    if constexpr (not IS_ALLOCATION_TRACKING_ENABLED)
+    {
+      return AllocationStatistics{.tag = TTag::NAME};
+    }
+    else
+    {
+      return _internal::getLedger<TTag>().snapshot();
+    }
+  }
+
+  [[nodiscard]] inline auto AllocationRegistry::getStatistics() -> vec<AllocationStatistics>
+  {
+    // Take a snapshot of every registered ledger
+    vec<AllocationStatistics> statistics;
+    for (const _internal::TagLedger* ledger{_internal::TagLedger::getFirst()}; ledger != nullptr;
+         ledger = ledger->getNext())
+    {
+      statistics.push_back(ledger->snapshot());
+    }
+
+    // Return the snapshots
+    return statistics;
+  }
+
+  inline auto AllocationRegistry::dump(std::ostream& os) -> none
+  {
+    // Print a notice if tracking is disabled
+    if constexpr (not IS_ALLOCATION_TRACKING_ENABLED)
+    {
+      os << "Allocation tracking is disabled\n";
+    }
+    else
+    {
+      // Print a row of totals for every tag, keeping the formatting of the caller
+      const vec<AllocationStatistics> statistics{getStatistics()};
+      const std::ios_base::fmtflags   flags{os.flags()};
+      os << std::left << std::setw(24) << "Tag" << std::right << std::setw(14) << "Allocations"
+         << std::setw(14) << "Frees" << std::setw(16) << "Bytes" << std::setw(16) << "Live"
+         << std::setw(16) << "Peak" << '\n';
+      for (const AllocationStatistics& tag : statistics)
+      {
+        os << std::left << std::setw(24) << tag.tag << std::right << std::setw(14)
+           << tag.allocationCount << std::setw(14) << tag.deallocationCount << std::setw(16)
+           << tag.allocatedByteCount << std::setw(16) << tag.liveByteCount << std::setw(16)
+           << tag.peakByteCount << '\n';
+
+        // Print the non-empty buckets of the size histogram
+        for (size bucket{0}; bucket < AllocationStatistics::HISTOGRAM_BUCKET_COUNT; ++bucket)
+        {
+          if (tag.histogram.at(bucket) != 0)
+          {
+            const bln isLast{bucket + 1 == AllocationStatistics::HISTOGRAM_BUCKET_COUNT};
+            os << "  " << (isLast ? "> " : "<= ") << std::setw(isLast ? 10 : 9)
+               << (isLast ? size{1} << (bucket - 1) : size{1} << bucket) << " B: "
+               << tag.histogram.at(bucket) << '\n';
+          }
+        }
+      }
+
+      // Restore the formatting of the caller
+      os.flags(flags);
+    }
+  }
+} // namespace fn::Memory
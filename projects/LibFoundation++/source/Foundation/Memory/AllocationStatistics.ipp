@@ -0,0 +1,93 @@
+#pragma once
+
+#include "Foundation/containers.hpp"
+#include "Foundation/types.hpp"
+
+#include <algorithm>
+#include <bit>
+
+namespace fn::Memory
+{
+  /**
+   * @brief   Whether tracking allocators record their allocations.
+   * @remark  Define `FN_TRACK_ALLOCATIONS` to enable tracking. When disabled, tracking allocators
+   *          forward directly to their inner allocator and the registry reports nothing.
+   * @warning `FN_TRACK_ALLOCATIONS` is a whole-program flag: every translation unit, including the
+   *          `LibFoundation++` library itself, must agree on it, as inline functions depend on it.
+   *          The CMake build applies its `FN_TRACK_ALLOCATIONS` option to every target that links
+   *          `fn::foundation`, and MSVC refuses to link objects that disagree.
+   */
+#if defined(FN_TRACK_ALLOCATIONS)
+  inline constexpr bln IS_ALLOCATION_TRACKING_ENABLED{true};
+#else
+  inline constexpr bln IS_ALLOCATION_TRACKING_ENABLED{false};
+#endif
+
+#if defined(_MSC_VER)
+  #if defined(FN_TRACK_ALLOCATIONS)
+    #pragma detect_mismatch("FN_TRACK_ALLOCATIONS", "1")
+  #else
+    #pragma detect_mismatch("FN_TRACK_ALLOCATIONS", "0")
+  #endif
+#endif
+
+  /**
+   * @brief A snapshot of the allocations made through the tracking allocators of one tag.
+   */
+  struct AllocationStatistics
+  {
+    /*-----------------------------------------------------------------------------------+--------*\
+    *| [public]: Constants                                                               | PUBLIC |*
+    \*-----------------------------------------------------------------------------------+--------*/
+
+    /**
+     * @brief  The number of buckets in the size histogram.
+     * @remark Bucket `i` counts allocations of up to `2^i` bytes that do not fit bucket `i - 1`;
+     *         the last bucket also counts every larger allocation.
+     */
+    static constexpr size HISTOGRAM_BUCKET_COUNT{24};
+
+    /*-----------------------------------------------------------------------------------+--------*\
+    *| [public]: Methods                                                                 | PUBLIC |*
+    \*-----------------------------------------------------------------------------------+--------*/
+
+    /**
+     * @brief   Selects the histogram bucket of an allocation size.
+     * @param   bytes The size of the allocation in bytes.
+     * @returns The index of the histogram bucket.
+     */
+    [[nodiscard]] static constexpr auto getBucket(size bytes) noexcept -> size;
+
+    /*-----------------------------------------------------------------------------------+--------*\
+    *| [public]: Fields                                                                  | PUBLIC |*
+    \*-----------------------------------------------------------------------------------+--------*/
+
+    strv                             tag;
+    u64                              allocationCount{0};
+    u64                              deallocationCount{0};
+    u64                              allocatedByteCount{0};
+    u64                              deallocatedByteCount{0};
+    u64                              liveByteCount{0};
+    u64                              peakByteCount{0};
+    arr<u64, HISTOGRAM_BUCKET_COUNT> histogram{};
+  };
+} // namespace fn::Memory
+
+/*------------------------------------------------------------------------------------------------*\
+*| <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<< Implementation >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>> |*
+\*------------------------------------------------------------------------------------------------*/
+
+namespace fn::Memory
+{
+  /*-------------------------------------------------------------------------------------+--------*\
+  *| [public]: Methods                                                                   | PUBLIC |*
+  \*-------------------------------------------------------------------------------------+--------*/
+
+  [[nodiscard]] constexpr auto AllocationStatistics::getBucket(const size bytes) noexcept -> size
+  {
+    // Round the size up to a power of two and clamp it into the histogram
+    return std::min<size>(
+      bytes <= 1 ? 0 : static_cast<size>(std::bit_width(bytes - 1)), HISTOGRAM_BUCKET_COUNT - 1
+    );
+  }
+} // namespace fn::Memory
@@ -0,0 +1,249 @@
+#pragma once
+
+#include "Foundation/Memory/AllocationRegistry.ipp"
+#include "Foundation/Memory/AllocationStatistics.ipp"
+#include "Foundation/Memory/_internal/AllocationLedger.ipp"
+#include "Foundation/Memory/_internal/concepts.hpp"
+#include "Foundation/concepts.hpp"
+#include "Foundation/types.hpp"
+
+#include <memory>
+
+namespace fn::Memory
+{
+  /**
+   * @brief The tag of tracked allocations that were not given a tag of their own.
+   */
+  struct UntaggedAllocation
+  {
+    static constexpr strv NAME{"untagged"};
+  };
+
+  /**
+   * @brief   An allocator that records the allocations of another allocator per tag.
+   * @details Records allocation and deallocation counts, bytes, peak usage and a size histogram in
+   *          per-thread counters, which `AllocationRegistry` aggregates on request. Fits the
+   *          `TAllocator` parameter of every container in `containers.hpp`, e.g.
+   *          `fn::vec<i32, fn::Memory::TrackingAllocator<i32, std::allocator<i32>, Sessions>>`.
+   * @tparam  T The type of the allocated elements.
+   * @tparam  TInner The type of the allocator that performs the allocations. Defaults to
+   *          `std::allocator<T>`.
+   * @tparam  TTag The tag that the allocations are recorded under, a type with a `NAME` constant.
+   *          Defaults to `UntaggedAllocation`.
+   * @note    Unless `FN_TRACK_ALLOCATIONS` is defined, the allocator forwards directly to the inner
+   *          allocator without recording anything.
+   */
+  template <
+    typename T,
+    typename TInner                 = std::allocator<T>,
+    _internal::IsAllocationTag TTag = UntaggedAllocation>
+  class TrackingAllocator
+  {
+    using Traits = std::allocator_traits<TInner>;
+
+    static_assert(IsSameAs<T, typename Traits::value_type>, "The inner allocator must allocate T!");
+
+  public:
+    /*-----------------------------------------------------------------------------------+--------*\
+    *| [public]: Types                                                                   | PUBLIC |*
+    \*-----------------------------------------------------------------------------------+--------*/
+
+    // NOLINTBEGIN(readability-identifier-naming)
+
+    using value_type                             = T;
+    using pointer                                = Traits::pointer;
+    using const_pointer                          = Traits::const_pointer;
+    using void_pointer                           = Traits::void_pointer;
+    using const_void_pointer                     = Traits::const_void_pointer;
+    using size_type                              = Traits::size_type;
+    using difference_type                        = Traits::difference_type;
+    using propagate_on_container_copy_assignment = Traits::propagate_on_container_copy_assignment;
+    using propagate_on_container_move_assignment = Traits::propagate_on_container_move_assignment;
+    using propagate_on_container_swap            = Traits::propagate_on_container_swap;
+    using is_always_equal                        = Traits::is_always_equal;
+
+    /**
+     * @brief  The tracking allocator of another element type with the same tag.
+     * @tparam TOther The other element type.
+     */
+    template <typename TOther>
+    struct rebind
+    {
+      using other = TrackingAllocator<TOther, typename Traits::template rebind_alloc<TOther>, TTag>;
+    };
+
+    // NOLINTEND(readability-identifier-naming)
+
+    /*-----------------------------------------------------------------------------------+--------*\
+    *| [public]: Constructors                                                            | PUBLIC |*
+    \*-----------------------------------------------------------------------------------+--------*/
+
+    /**
+     * @brief Constructs a tracking allocator with a default-constructed inner allocator.
+     */
+    TrackingAllocator() = default;
+
+    /**
+     * @brief Constructs a tracking allocator around an inner allocator.
+     * @param inner The inner allocator.
+     */
+    explicit TrackingAllocator(const TInner& inner) noexcept;
+
+    /**
+     * @brief  Constructs a tracking allocator from a tracking allocator of another element type.
+     * @param  other The other tracking allocator.
+     * @tparam TOther The other element type.
+     * @tparam TOtherInner The type of the other inner allocator.
+     */
+    template <typename TOther, typename TOtherInner>
+    TrackingAllocator( // NOLINT(google-explicit-constructor, hicpp-explicit-conversions)
+      const TrackingAllocator<TOther, TOtherInner, TTag>& other
+    ) noexcept;
+
+    /*-----------------------------------------------------------------------------------+--------*\
+    *| [public]: Methods                                                                 | PUBLIC |*
+    \*-----------------------------------------------------------------------------------+--------*/
+
+    /**
+     * @brief   Allocates storage for a number of elements and records the allocation.
+     * @param   count The number of elements.
+     * @returns A pointer to the allocated storage.
+     * @throws  std::bad_alloc If the inner allocator fails.
+     */
+    [[nodiscard]] auto allocate(size_type count) -> pointer;
+
+    /**
+     * @brief Releases storage obtained from `allocate` and records the deallocation.
+     * @param storage The storage to release.
+     * @param count The number of elements, as passed to `allocate`.
+     */
+    auto deallocate(pointer storage, size_type count) noexcept -> none;
+
+    /**
+     * @brief   Obtains the allocator of a copy-constructed container.
+     * @returns The tracking allocator around the inner allocator the inner allocator selects.
+     */
+    // NOLINTNEXTLINE(readability-identifier-naming)
+    [[nodiscard]] auto select_on_container_copy_construction() const -> TrackingAllocator;
+
+    /*-----------------------------------------------------------------------------------+--------*\
+    *| [public]: Accessors                                                               | PUBLIC |*
+    \*-----------------------------------------------------------------------------------+--------*/
+
+    /**
+     * @brief   Accessor for the inner allocator.
+     * @returns The inner allocator.
+     */
+    [[nodiscard]] auto getInner() const noexcept -> const TInner&;
+
+  private:
+    /*----------------------------------------------------------------------------------+---------*\
+    *| [private]: Fields                                                                | PRIVATE |*
+    \*----------------------------------------------------------------------------------+---------*/
+
+#if defined(_MSC_VER)
+    [[msvc::no_unique_address]] TInner m_inner;
+#else
+    [[no_unique_address]] TInner m_inner;
+#endif
+
+    /*----------------------------------------------------------------------------------+---------*\
+    *| [private]: Friends                                                               | PRIVATE |*
+    \*----------------------------------------------------------------------------------+---------*/
+
+    template <typename TOther, typename TOtherInner, _internal::IsAllocationTag TOtherTag>
+    friend class TrackingAllocator;
+
+    /**
+     * @brief   Compares two tracking allocators of the same tag.
+     * @param   lhs The first tracking allocator.
+     * @param   rhs The second tracking allocator.
+     * @tparam  TOther The element type of the second tracking allocator.
+     * @tparam  TOtherInner The type of the inner allocator of the second tracking allocator.
+     * @returns Whether storage allocated by one can be released by the other.
+     */
+    template <typename TOther, typename TOtherInner>
+    friend auto operator==(
+      const TrackingAllocator& lhs, const TrackingAllocator<TOther, TOtherInner, TTag>& rhs
+    ) noexcept -> bln
+    {
+      return lhs.m_inner == rhs.getInner();
+    }
+  };
+} // namespace fn::Memory
+
+/*------------------------------------------------------------------------------------------------*\
+*| <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<< Implementation >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>> |*
+\*------------------------------------------------------------------------------------------------*/
+
+namespace fn::Memory
+{
+  /*-------------------------------------------------------------------------------------+--------*\
+  *| [public]: Constructors                                                              | PUBLIC |*
+  \*-------------------------------------------------------------------------------------+--------*/
+
+  template <typename T, typename TInner, _internal::IsAllocationTag TTag>
+  TrackingAllocator<T, TInner, TTag>::TrackingAllocator(const TInner& inner) noexcept
+    : m_inner{inner}
+  {}
+
+  template <typename T, typename TInner, _internal::IsAllocationTag TTag>
+  template <typename TOther, typename TOtherInner>
+  TrackingAllocator<T, TInner, TTag>::TrackingAllocator(
+    const TrackingAllocator<TOther, TOtherInner, TTag>& other
+  ) noexcept
+    : m_inner{other.m_inner}
+  {}
+
+  /*-------------------------------------------------------------------------------------+--------*\
+  *| [public]: Methods                                                                   | PUBLIC |*
+  \*-------------------------------------------------------------------------------------+--------*/
+
+  template <typename T, typename TInner, _internal::IsAllocationTag TTag>
+  [[nodiscard]] auto TrackingAllocator<T, TInner, TTag>::allocate(const size_type count) -> pointer
+  {
+    // Allocate through the inner allocator
+    const pointer storage{Traits::allocate(m_inner, count)};
+
+    // Record the allocation once it succeeded
+    if constexpr (IS_ALLOCATION_TRACKING_ENABLED)
+    {
+      _internal::record<TTag>(count * sizeof(T), true);
+    }
+
+    // Return the storage
+    return storage;
+  }
+
+  template <typename T, typename TInner, _internal::IsAllocationTag TTag>
+  auto TrackingAllocator<T, TInner, TTag>::deallocate(
+    const pointer storage, const size_type count
+  ) noexcept -> none
+  {
+    // Record the deallocation
+    if constexpr (IS_ALLOCATION_TRACKING_ENABLED)
+    {
+      _internal::record<TTag>(count * sizeof(T), false);
+    }
+
+    // Release through the inner allocator
+    Traits::deallocate(m_inner, storage, count);
+  }
+
+  template <typename T, typename TInner, _internal::IsAllocationTag TTag>
+  [[nodiscard]] auto TrackingAllocator<T, TInner, TTag>::select_on_container_copy_construction(
+  ) const -> TrackingAllocator
+  {
+    return TrackingAllocator{Traits::select_on_container_copy_construction(m_inner)};
+  }
+
+  /*-------------------------------------------------------------------------------------+--------*\
+  *| [public]: Accessors                                                                 | PUBLIC |*
+  \*-------------------------------------------------------------------------------------+--------*/
+
+  template <typename T, typename TInner, _internal::IsAllocationTag TTag>
+  [[nodiscard]] auto TrackingAllocator<T, TInner, TTag>::getInner() const noexcept -> const TInner&
+  {
+    return m_inner;
+  }
+} // namespace fn::Memory
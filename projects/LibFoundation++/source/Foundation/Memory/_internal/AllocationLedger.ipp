@@ -0,0 +1,486 @@
+#pragma once
+
+#include "Foundation/Memory/AllocationStatistics.ipp"
+#include "Foundation/Memory/_internal/concepts.hpp"
+#include "Foundation/containers.hpp"
+#include "Foundation/types.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <new>
+
+namespace fn::Memory::_internal
+{
+  /**
+   * @brief   The allocation counters of one thread for one tag.
+   * @details Only the owning thread writes the counters, so they are updated with plain relaxed
+   *          loads and stores instead of read-modify-write instructions; the registry may read them
+   *          concurrently. Each block fills whole cache lines so that threads never share one.
+   */
+  struct alignas(64) ThreadCounters
+  {
+    /*-----------------------------------------------------------------------------------+--------*\
+    *| [public]: Constants                                                               | PUBLIC |*
+    \*-----------------------------------------------------------------------------------+--------*/
+
+    /**
+     * @brief The net number of bytes a thread may accumulate before it publishes them to the live
+     *        byte count of its tag, which bounds the error of the peak usage per thread.
+     */
+    static constexpr i64 PUBLISH_THRESHOLD{64 * 1'024};
+
+    /*-----------------------------------------------------------------------------------+--------*\
+    *| [public]: Methods                                                                 | PUBLIC |*
+    \*-----------------------------------------------------------------------------------+--------*/
+
+    /**
+     * @brief Records an allocation.
+     * @param bytes The size of the allocation in bytes.
+     */
+    auto addAllocation(size bytes) noexcept -> none;
+
+    /**
+     * @brief Records a deallocation.
+     * @param bytes The size of the deallocation in bytes.
+     */
+    auto addDeallocation(size bytes) noexcept -> none;
+
+    /**
+     * @brief Adds the counters to a snapshot.
+     * @param statistics The snapshot to add to.
+     */
+    auto collect(AllocationStatistics& statistics) const noexcept -> none;
+
+    /*-----------------------------------------------------------------------------------+--------*\
+    *| [public]: Fields                                                                  | PUBLIC |*
+    \*-----------------------------------------------------------------------------------+--------*/
+
+    std::atomic<u64>                                                    allocationCount{0};
+    std::atomic<u64>                                                    deallocationCount{0};
+    std::atomic<u64>                                                    allocatedByteCount{0};
+    std::atomic<u64>                                                    deallocatedByteCount{0};
+    arr<std::atomic<u64>, AllocationStatistics::HISTOGRAM_BUCKET_COUNT> histogram{};
+    i64                                                                 unpublishedByteCount{0};
+    bln                                                                 isLeased{false};
+    ThreadCounters*                                                     next{nullptr};
+  };
+
+  /**
+   * @brief   The ledger of every allocation made through the tracking allocators of one tag.
+   * @details Threads lease counter blocks from the ledger and return them on exit for reuse by
+   *          later threads. Blocks and ledgers are never freed, so that containers destroyed during
+   *          static destruction can still record their deallocations.
+   */
+  class TagLedger final
+  {
+  public:
+    /*-----------------------------------------------------------------------------------+--------*\
+    *| [public]: Constructors                                                            | PUBLIC |*
+    \*-----------------------------------------------------------------------------------+--------*/
+
+    /**
+     * @brief Constructs an empty ledger and registers it in the list of ledgers.
+     * @param name The name of the tag.
+     */
+    explicit TagLedger(strv name) noexcept;
+
+    /*-----------------------------------------------------------------------------------+--------*\
+    *| [public]: Methods                                                                 | PUBLIC |*
+    \*-----------------------------------------------------------------------------------+--------*/
+
+    /**
+     * @brief   Leases a counter block to the calling thread.
+     * @returns The leased counter block.
+     * @throws  std::bad_alloc If a new block cannot be allocated.
+     */
+    [[nodiscard]] auto acquire() -> ThreadCounters*;
+
+    /**
+     * @brief Returns a leased counter block.
+     * @param counters The counter block to return.
+     */
+    auto release(ThreadCounters& counters) noexcept -> none;
+
+    /**
+     * @brief Publishes the unpublished bytes of a counter block and updates the peak usage.
+     * @param counters The counter block to publish, owned by the calling thread.
+     */
+    auto publish(ThreadCounters& counters) noexcept -> none;
+
+    /**
+     * @brief Records an allocation or deallocation of a thread without a counter block.
+     * @param bytes The size of the allocation in bytes.
+     * @param isAllocation Whether the bytes are allocated or deallocated.
+     */
+    auto recordShared(size bytes, bln isAllocation) noexcept -> none;
+
+    /**
+     * @brief   Takes a snapshot of the ledger.
+     * @returns The statistics of the tag.
+     */
+    [[nodiscard]] auto snapshot() const noexcept -> AllocationStatistics;
+
+    /*-----------------------------------------------------------------------------------+--------*\
+    *| [public]: Accessors                                                               | PUBLIC |*
+    \*-----------------------------------------------------------------------------------+--------*/
+
+    /**
+     * @brief   Accessor for the first registered ledger.
+     * @returns The most recently registered ledger, or `nullptr` if there is none.
+     */
+    [[nodiscard]] static auto getFirst() noexcept -> const TagLedger*;
+
+    /**
+     * @brief   Accessor for the next registered ledger.
+     * @returns The previously registered ledger, or `nullptr` if there is none.
+     */
+    [[nodiscard]] auto getNext() const noexcept -> const TagLedger*;
+
+  private:
+    /*----------------------------------------------------------------------------------+---------*\
+    *| [private]: Methods                                                               | PRIVATE |*
+    \*----------------------------------------------------------------------------------+---------*/
+
+    /**
+     * @brief   Accessor for the head of the list of ledgers.
+     * @returns The head of the list of ledgers.
+     */
+    [[nodiscard]] static auto head() noexcept -> std::atomic<TagLedger*>&;
+
+    /*----------------------------------------------------------------------------------+---------*\
+    *| [private]: Fields                                                                | PRIVATE |*
+    \*----------------------------------------------------------------------------------+---------*/
+
+    strv               m_name;
+    mutable std::mutex m_mutex;
+    ThreadCounters*    m_threads{nullptr};
+    ThreadCounters     m_shared;
+    std::atomic<i64>   m_liveByteCount{0};
+    std::atomic<u64>   m_peakByteCount{0};
+    TagLedger*         m_next{nullptr};
+  };
+
+  /**
+   * @brief Returns the counter block of a thread to its ledger when the thread exits.
+   */
+  struct ThreadLease
+  {
+    TagLedger&       ledger;
+    ThreadCounters*& counters;
+    bln&             isReleased;
+
+    ThreadLease(TagLedger& ledger, ThreadCounters*& counters, bln& isReleased) noexcept;
+
+    ThreadLease(const ThreadLease&) = delete;
+
+    ThreadLease(ThreadLease&&) = delete;
+
+    ~ThreadLease();
+
+    auto operator=(const ThreadLease&) -> ThreadLease& = delete;
+
+    auto operator=(ThreadLease&&) -> ThreadLease& = delete;
+  };
+
+  /**
+   * @brief   Accessor for the ledger of a tag.
+   * @tparam  TTag The tag.
+   * @returns The ledger of the tag.
+   */
+  template <IsAllocationTag TTag>
+  [[nodiscard]] auto getLedger() noexcept -> TagLedger&;
+
+  /**
+   * @brief   Accessor for the counter block of the calling thread for a tag.
+   * @param   ledger The ledger of the tag.
+   * @tparam  TTag The tag.
+   * @returns The counter block, or `nullptr` if the thread has none, e.g. because it is exiting.
+   */
+  template <IsAllocationTag TTag>
+  [[nodiscard]] auto getThreadCounters(TagLedger& ledger) noexcept -> ThreadCounters*;
+
+  /**
+   * @brief  Records an allocation or deallocation for a tag.
+   * @param  bytes The size of the allocation in bytes.
+   * @param  isAllocation Whether the bytes are allocated or deallocated.
+   * @tparam TTag The tag.
+   */
+  template <IsAllocationTag TTag>
+  auto record(size bytes, bln isAllocation) noexcept -> none;
+} // namespace fn::Memory::_internal
+
+/*------------------------------------------------------------------------------------------------*\
+*| <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<< Implementation >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>> |*
+\*------------------------------------------------------------------------------------------------*/
+
+namespace fn::Memory::_internal
+{
+  /*-------------------------------------------------------------------------------------+--------*\
+  *| [public]: ThreadCounters                                                            | PUBLIC |*
+  \*-------------------------------------------------------------------------------------+--------*/
+
+  inline auto ThreadCounters::addAllocation(const size bytes) noexcept -> none
+  {
+    constexpr auto RELAXED{std::memory_order_relaxed};
+
+    // Bump the counters without read-modify-write instructions, as this thread is the only writer
+    allocationCount.store(allocationCount.load(RELAXED) + 1, RELAXED);
+    allocatedByteCount.store(allocatedByteCount.load(RELAXED) + bytes, RELAXED);
+    std::atomic<u64>& bucket{histogram.at(AllocationStatistics::getBucket(bytes))};
+    bucket.store(bucket.load(RELAXED) + 1, RELAXED);
+    unpublishedByteCount += static_cast<i64>(bytes);
+  }
+
+  inline auto ThreadCounters::addDeallocation(const size bytes) noexcept -> none
+  {
+    constexpr auto RELAXED{std::memory_order_relaxed};
+
+    // Bump the counters without read-modify-write instructions, as this thread is the only writer
+    deallocationCount.store(deallocationCount.load(RELAXED) + 1, RELAXED);
+    deallocatedByteCount.store(deallocatedByteCount.load(RELAXED) + bytes, RELAXED);
+    unpublishedByteCount -= static_cast<i64>(bytes);
+  }
+
+  inline auto ThreadCounters::collect(AllocationStatistics& statistics) const noexcept -> none
+  {
+    constexpr auto RELAXED{std::memory_order_relaxed};
+
+    // Add the counters
+    statistics.allocationCount += allocationCount.load(RELAXED);
+    statistics.deallocationCount += deallocationCount.load(RELAXED);
+    statistics.allocatedByteCount += allocatedByteCount.load(RELAXED);
+    statistics.deallocatedByteCount += deallocatedByteCount.load(RELAXED);
+
+    // Add the histogram
+    for (size bucket{0}; bucket < AllocationStatistics::HISTOGRAM_BUCKET_COUNT; ++bucket)
+    {
+      statistics.histogram.at(bucket) += histogram.at(bucket).load(RELAXED);
+    }
+  }
+
+  /*-------------------------------------------------------------------------------------+--------*\
+  *| [public]: TagLedger                                                                 | PUBLIC |*
+  \*-------------------------------------------------------------------------------------+--------*/
+
+  inline TagLedger::TagLedger(const strv name) noexcept
+    : m_name{name}
+  {
+    // Push the ledger onto the list of ledgers
+    std::atomic<TagLedger*>& first{head()};
+    m_next = first.load(std::memory_order_relaxed);
+    while (not first.compare_exchange_weak(m_next, this, std::memory_order_release))
+    {}
+  }
+
+  [[nodiscard]] inline auto TagLedger::acquire() -> ThreadCounters*
+  {
+    const std::scoped_lock lock{m_mutex};
+
+    // Reuse a block returned by an exited thread if available
+    for (ThreadCounters* counters{m_threads}; counters != nullptr; counters = counters->next)
+    {
+      if (not counters->isLeased)
+      {
+        counters->isLeased = true;
+        return counters;
+      }
+    }
+
+    // NOLINTBEGIN(cppcoreguidelines-owning-memory)
+
+    // Allocate a new block, which is never freed
+    auto* const counters{new ThreadCounters{}};
+    counters->isLeased = true;
+    counters->next     = m_threads;
+    m_threads          = counters;
+    return counters;
+
+    // NOLINTEND(cppcoreguidelines-owning-memory)
+  }
+
+  inline auto TagLedger::release(ThreadCounters& counters) noexcept -> none
+  {
+    // Publish the remaining bytes before another thread takes over the block
+    publish(counters);
+
+    const std::scoped_lock lock{m_mutex};
+    counters.isLeased = false;
+  }
+
+  inline auto TagLedger::publish(ThreadCounters& counters) noexcept -> none
+  {
+    // Add the unpublished bytes to the live byte count
+    const i64 delta{std::exchange(counters.unpublishedByteCount, 0)};
+    const i64 live{m_liveByteCount.fetch_add(delta, std::memory_order_relaxed) + delta};
+
+    // Raise the peak usage if exceeded
+    u64 peak{m_peakByteCount.load(std::memory_order_relaxed)};
+    while (live > 0 and static_cast<u64>(live) > peak
+           and not m_peakByteCount.compare_exchange_weak(
+             peak, static_cast<u64>(live), std::memory_order_relaxed
+           ))
+    {}
+  }
+
+  inline auto TagLedger::recordShared(const size bytes, const bln isAllocation) noexcept -> none
+  {
+    const std::scoped_lock lock{m_mutex};
+
+    // Record on the shared block
+    if (isAllocation)
+    {
+      m_shared.addAllocation(bytes);
+    }
+    else
+    {
+      m_shared.addDeallocation(bytes);
+    }
+
+    // Publish the bytes right away, as no thread owns the shared block
+    publish(m_shared);
+  }
+
+  [[nodiscard]] inline auto TagLedger::snapshot() const noexcept -> AllocationStatistics
+  {
+    AllocationStatistics statistics{.tag = m_name};
+
+    // Sum the counters of every thread
+    {
+      const std::scoped_lock lock{m_mutex};
+      m_shared.collect(statistics);
+      for (const ThreadCounters* counters{m_threads}; counters != nullptr;
+           counters = counters->next)
+      {
+        counters->collect(statistics);
+      }
+    }
+
+    // Derive the live bytes from the totals, which are exact unlike the published count
+    if (statistics.allocatedByteCount > statistics.deallocatedByteCount)
+    {
+      statistics.liveByteCount = statistics.allocatedByteCount - statistics.deallocatedByteCount;
+    }
+
+    // Report the peak usage, which is at least the current usage
+    statistics.peakByteCount
+      = std::max(m_peakByteCount.load(std::memory_order_relaxed), statistics.liveByteCount);
+
+    // Return the snapshot
+    return statistics;
+  }
+
+  [[nodiscard]] inline auto TagLedger::getFirst() noexcept -> const TagLedger*
+  {
+    return head().load(std::memory_order_acquire);
+  }
+
+  [[nodiscard]] inline auto TagLedger::getNext() const noexcept -> const TagLedger*
+  {
+    return m_next;
+  }
+
+  [[nodiscard]] inline auto TagLedger::head() noexcept -> std::atomic<TagLedger*>&
+  {
+    static std::atomic<TagLedger*> s_head{nullptr};
+    return s_head;
+  }
+
+  /*-------------------------------------------------------------------------------------+--------*\
+  *| [public]: ThreadLease                                                               | PUBLIC |*
+  \*-------------------------------------------------------------------------------------+--------*/
+
+  inline ThreadLease::ThreadLease(
+    TagLedger& ledger, ThreadCounters*& counters, bln& isReleased
+  ) noexcept
+    : ledger{ledger}
+    , counters{counters}
+    , isReleased{isReleased}
+  {}
+
+  inline ThreadLease::~ThreadLease()
+  {
+    // Return the block and route any later record of this thread to the shared block
+    ledger.release(*counters);
+    counters   = nullptr;
+    isReleased = true;
+  }
+
+  /*-------------------------------------------------------------------------------------+--------*\
+  *| [public]: Functions                                                                 | PUBLIC |*
+  \*-------------------------------------------------------------------------------------+--------*/
+
+  template <IsAllocationTag TTag>
+  [[nodiscard]] auto getLedger() noexcept -> TagLedger&
+  {
+    // NOLINTBEGIN(cppcoreguidelines-owning-memory)
+
+    // Create the ledger on first use and never free it
+    static TagLedger* const s_ledger{new TagLedger{TTag::NAME}};
+    return *s_ledger;
+
+    // NOLINTEND(cppcoreguidelines-owning-memory)
+  }
+
+  template <IsAllocationTag TTag>
+  [[nodiscard]] auto getThreadCounters(TagLedger& ledger) noexcept -> ThreadCounters*
+  {
+    thread_local ThreadCounters* t_counters{nullptr};
+    thread_local bln             t_isReleased{false};
+
+    // Return the leased block on the fast path
+    if (t_counters != nullptr) [[likely]]
+    {
+      return t_counters;
+    }
+
+    // Return nothing if the block was already returned on thread exit
+    if (t_isReleased)
+    {
+      return nullptr;
+    }
+
+    // Lease a block and return it when the thread exits
+    try
+    {
+      t_counters = ledger.acquire();
+    }
+    catch (const std::bad_alloc&)
+    {
+      return nullptr;
+    }
+    thread_local const ThreadLease t_lease{ledger, t_counters, t_isReleased};
+    return t_counters;
+  }
+
+  template <IsAllocationTag TTag>
+  auto record(const size bytes, const bln isAllocation) noexcept -> none
+  {
+    TagLedger& ledger{getLedger<TTag>()};
+
+    // Fall back to the shared block if the thread has no block of its own
+    ThreadCounters* const counters{getThreadCounters<TTag>(ledger)};
+    if (counters == nullptr) [[unlikely]]
+    {
+      ledger.recordShared(bytes, isAllocation);
+      return;
+    }
+
+    // Record on the block of the thread
+    if (isAllocation)
+    {
+      counters->addAllocation(bytes);
+    }
+    else
+    {
+      counters->addDeallocation(bytes);
+    }
+
+    // Publish the bytes once enough of them have accumulated
+    if (counters->unpublishedByteCount >= ThreadCounters::PUBLISH_THRESHOLD
+        or counters->unpublishedByteCount <= -ThreadCounters::PUBLISH_THRESHOLD)
+    {
+      ledger.publish(*counters);
+    }
+  }
+} // namespace fn::Memory::_internal
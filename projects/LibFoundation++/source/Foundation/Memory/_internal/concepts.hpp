@@ -0,0 +1,17 @@
+#pragma once
+
+#include "Foundation/types.hpp"
+
+#include <concepts>
+
+namespace fn::Memory::_internal
+{
+  /**
+   * @brief Concept to check if a type can tag tracked allocations, i.e. it names its statistics
+   *        through a `NAME` constant convertible to `strv`.
+   */
+  template <typename T>
+  concept IsAllocationTag = requires {
+    { T::NAME } -> std::convertible_to<strv>;
+  };
+} // namespace fn::Memory::_internal
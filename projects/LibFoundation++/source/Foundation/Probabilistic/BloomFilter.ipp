@@ -0,0 +1,412 @@
+#pragma once
+
+#include "Foundation/Probabilistic/Hash.ipp"
+#include "Foundation/Probabilistic/_internal/bytes.ipp"
+#include "Foundation/concepts.hpp"
+#include "Foundation/containers.hpp"
+#include "Foundation/errors.hpp"
+#include "Foundation/types.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <numbers>
+#include <span>
+
+#if defined(_MSC_VER)
+  #include <intrin.h>
+#endif
+
+namespace fn::Probabilistic
+{
+  /**
+   * @brief   A blocked Bloom filter for approximate set membership without false negatives.
+   * @details Every key touches a single cache-line-sized block of eight 64-bit words and sets one
+   *          bit in each word, so both insertion and lookup cost one cache miss. The eight bit
+   *          positions are derived from one hash by multiplying with eight odd constants, which
+   *          compilers turn into vector code.
+   * @tparam  T The type of the keys.
+   * @tparam  THash The type of the hash function, which must return a well-mixed `u64`.
+   * @tparam  TAllocator The type of the allocator, rebound to the block type. Defaults to
+   *          `std::allocator<T>`.
+   */
+  template <typename T, typename THash = Hash<T>, typename TAllocator = std::allocator<T>>
+  class BloomFilter final
+  {
+  public:
+    /*-----------------------------------------------------------------------------------+--------*\
+    *| [public]: Types                                                                   | PUBLIC |*
+    \*-----------------------------------------------------------------------------------+--------*/
+
+    /**
+     * @brief A cache-line-sized group of bits that a key is confined to.
+     */
+    struct alignas(64) Block
+    {
+      arr<u64, 8> words;
+    };
+
+    /*-----------------------------------------------------------------------------------+--------*\
+    *| [public]: Constructors                                                            | PUBLIC |*
+    \*-----------------------------------------------------------------------------------+--------*/
+
+    /**
+     * @brief  Constructs an empty filter sized for a number of keys and a false-positive rate.
+     * @param  expectedCount The expected number of distinct keys.
+     * @param  falsePositiveRate The targeted false-positive rate in `(0, 1)`.
+     * @param  allocator The allocator.
+     * @throws ArgumentError If the false-positive rate is out of range.
+     * @note   Blocking trades a slightly higher false-positive rate for locality.
+     */
+    BloomFilter(size expectedCount, f64 falsePositiveRate, const TAllocator& allocator = {});
+
+    /*-----------------------------------------------------------------------------------+--------*\
+    *| [public]: Methods                                                                 | PUBLIC |*
+    \*-----------------------------------------------------------------------------------+--------*/
+
+    /**
+     * @brief Inserts a key.
+     * @param key The key to insert.
+     */
+    auto insert(const T& key) noexcept -> none;
+
+    /**
+     * @brief   Checks whether a key may have been inserted.
+     * @param   key The key to check.
+     * @returns `false` if the key was never inserted, `true` if it probably was.
+     */
+    [[nodiscard]] auto contains(const T& key) const noexcept -> bln;
+
+    /**
+     * @brief  Adds every key of another filter to this filter.
+     * @param  other The filter to merge, sized identically.
+     * @throws ArgumentError If the filters have different sizes.
+     */
+    auto merge(const BloomFilter& other) -> none;
+
+    /**
+     * @brief Removes every key.
+     */
+    auto clear() noexcept -> none;
+
+    /**
+     * @brief   Serializes the filter into a portable little-endian byte buffer.
+     * @returns The serialized filter.
+     * @note    Only hosts that hash keys identically can share serialized filters.
+     */
+    [[nodiscard]] auto serialize() const -> vec<byte>;
+
+    /**
+     * @brief   Restores a filter serialized by `serialize`.
+     * @param   bytes The serialized filter.
+     * @param   allocator The allocator.
+     * @returns The restored filter.
+     * @throws  InputError If the bytes are not a serialized Bloom filter.
+     */
+    [[nodiscard]] static auto deserialize(
+      std::span<const byte> bytes, const TAllocator& allocator = {}
+    ) -> BloomFilter;
+
+    /*-----------------------------------------------------------------------------------+--------*\
+    *| [public]: Accessors                                                               | PUBLIC |*
+    \*-----------------------------------------------------------------------------------+--------*/
+
+    /**
+     * @brief   Accessor for the number of blocks.
+     * @returns The number of blocks.
+     */
+    [[nodiscard]] auto getBlockCount() const noexcept -> size;
+
+    /**
+     * @brief   Accessor for the memory used by the bits.
+     * @returns The number of bytes used by the bits.
+     */
+    [[nodiscard]] auto getByteCount() const noexcept -> size;
+
+  private:
+    /*----------------------------------------------------------------------------------+---------*\
+    *| [private]: Constants                                                             | PRIVATE |*
+    \*----------------------------------------------------------------------------------+---------*/
+
+    static constexpr u32 MAGIC{0x46'4E'42'46};
+
+    static constexpr arr<u32, 8> SALTS{
+      0x47'B6'13'7B,
+      0x44'97'4D'91,
+      0x87'04'F1'87,
+      0xA2'B7'28'9D,
+      0x70'5A'EE'5B,
+      0x2D'F1'42'4B,
+      0x9E'FC'49'75,
+      0x5C'6B'FB'31
+    };
+
+    /*----------------------------------------------------------------------------------+---------*\
+    *| [private]: Types                                                                 | PRIVATE |*
+    \*----------------------------------------------------------------------------------+---------*/
+
+    using BlockAllocator = std::allocator_traits<TAllocator>::template rebind_alloc<Block>;
+
+    /*----------------------------------------------------------------------------------+---------*\
+    *| [private]: Fields                                                                | PRIVATE |*
+    \*----------------------------------------------------------------------------------+---------*/
+
+    vec<Block, BlockAllocator> m_blocks;
+
+    /*----------------------------------------------------------------------------------+---------*\
+    *| [private]: Methods                                                               | PRIVATE |*
+    \*----------------------------------------------------------------------------------+---------*/
+
+    /**
+     * @brief Constructs an empty filter with an exact number of blocks.
+     * @param blockCount The number of blocks.
+     * @param allocator The allocator.
+     */
+    BloomFilter(size blockCount, const TAllocator& allocator);
+
+    /**
+     * @brief   Computes the bits a key sets in its block.
+     * @param   hash The hash of the key.
+     * @returns One single-bit mask per word of the block.
+     */
+    [[nodiscard]] static auto masksOf(u64 hash) noexcept -> arr<u64, 8>;
+
+    /**
+     * @brief   Selects the block of a key.
+     * @param   hash The hash of the key.
+     * @returns The block of the key.
+     */
+    [[nodiscard]] auto blockOf(u64 hash) const noexcept -> size;
+  };
+} // namespace fn::Probabilistic
+
+/*------------------------------------------------------------------------------------------------*\
+*| <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<< Implementation >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>> |*
+\*------------------------------------------------------------------------------------------------*/
+
+namespace fn::Probabilistic
+{
+  // NOLINTBEGIN(cppcoreguidelines-pro-bounds-constant-array-index)
+
+  /*-------------------------------------------------------------------------------------+--------*\
+  *| [public]: Constructors                                                              | PUBLIC |*
+  \*-------------------------------------------------------------------------------------+--------*/
+
+  template <typename T, typename THash, typename TAllocator>
+  BloomFilter<T, THash, TAllocator>::BloomFilter(
+    const size expectedCount, const f64 falsePositiveRate, const TAllocator& allocator
+  )
+    : m_blocks{BlockAllocator{allocator}}
+  {
+    // Throw error if the false-positive rate is out of range
+    if (not(falsePositiveRate > 0.0 and falsePositiveRate < 1.0))
+    {
+      throw ArgumentError{"False-positive rate out of range!", std::to_string(falsePositiveRate)};
+    }
+
+    // Size the filter as a classic Bloom filter, rounded up to whole blocks
+    const f64 bitCount{
+      std::ceil(
+        -static_cast<f64>(std::max<size>(expectedCount, 1)) * std::log(falsePositiveRate)
+        / (std::numbers::ln2 * std::numbers::ln2)
+      )
+    };
+    const auto blockCount{static_cast<size>(std::ceil(bitCount / (sizeof(Block) * 8)))};
+    m_blocks.resize(std::max<size>(blockCount, 1));
+  }
+
+  /*-------------------------------------------------------------------------------------+--------*\
+  *| [public]: Methods                                                                   | PUBLIC |*
+  \*-------------------------------------------------------------------------------------+--------*/
+
+  template <typename T, typename THash, typename TAllocator>
+  auto BloomFilter<T, THash, TAllocator>::insert(const T& key) noexcept -> none
+  {
+    const u64   hash{THash{}(key)};
+    const auto  masks{masksOf(hash)};
+    arr<u64, 8>& words{m_blocks[blockOf(hash)].words};
+    for (size index{0}; index < words.size(); ++index)
+    {
+      words[index] |= masks[index];
+    }
+  }
+
+  template <typename T, typename THash, typename TAllocator>
+  [[nodiscard]] auto BloomFilter<T, THash, TAllocator>::contains(const T& key) const noexcept
+    -> bln
+  {
+    const u64          hash{THash{}(key)};
+    const auto         masks{masksOf(hash)};
+    const arr<u64, 8>& words{m_blocks[blockOf(hash)].words};
+    u64                missing{0};
+    for (size index{0}; index < words.size(); ++index)
+    {
+      missing |= masks[index] & ~words[index];
+    }
+    return missing == 0;
+  }
+
+  template <typename T, typename THash, typename TAllocator>
+  auto BloomFilter<T, THash, TAllocator>::merge(const BloomFilter& other) -> none
+  {
+    // Throw error if the filters have different sizes
+    if (other.m_blocks.size() != m_blocks.size())
+    {
+      throw ArgumentError{"Filter size mismatch!", std::to_string(other.m_blocks.size())};
+    }
+
+    // Union the bits
+    for (size block{0}; block < m_blocks.size(); ++block)
+    {
+      for (size index{0}; index < m_blocks[block].words.size(); ++index)
+      {
+        m_blocks[block].words[index] |= other.m_blocks[block].words[index];
+      }
+    }
+  }
+
+  template <typename T, typename THash, typename TAllocator>
+  auto BloomFilter<T, THash, TAllocator>::clear() noexcept -> none
+  {
+    std::ranges::fill(m_blocks, Block{});
+  }
+
+  template <typename T, typename THash, typename TAllocator>
+  [[nodiscard]] auto BloomFilter<T, THash, TAllocator>::serialize() const -> vec<byte>
+  {
+    // Write the header
+    vec<byte> bytes;
+    bytes.reserve(sizeof(u32) + sizeof(u64) + (m_blocks.size() * sizeof(Block)));
+    _internal::appendLittleEndian(bytes, MAGIC);
+    _internal::appendLittleEndian(bytes, static_cast<u64>(m_blocks.size()));
+
+    // Write the bits
+    for (const Block& block : m_blocks)
+    {
+      for (const u64 word : block.words)
+      {
+        _internal::appendLittleEndian(bytes, word);
+      }
+    }
+
+    // Return the serialized filter
+    return bytes;
+  }
+
+  template <typename T, typename THash, typename TAllocator>
+  [[nodiscard]] auto BloomFilter<T, THash, TAllocator>::deserialize(
+    const std::span<const byte> bytes, const TAllocator& allocator
+  ) -> BloomFilter
+  {
+    _internal::ByteReader reader{bytes};
+
+    // Throw error if the header does not belong to a Bloom filter
+    const auto magic{reader.template read<u32>()};
+    const auto blockCount{reader.template read<u64>()};
+    if (magic != MAGIC or blockCount == 0
+        or blockCount != (bytes.size() - sizeof(u32) - sizeof(u64)) / sizeof(Block))
+    {
+      throw InputError{"Malformed Bloom filter!", std::to_string(bytes.size())};
+    }
+
+    // Read the bits
+    BloomFilter filter{static_cast<size>(blockCount), allocator};
+    for (Block& block : filter.m_blocks)
+    {
+      for (u64& word : block.words)
+      {
+        word = reader.template read<u64>();
+      }
+    }
+
+    // Throw error if there are trailing bytes
+    if (not reader.isExhausted())
+    {
+      throw InputError{"Malformed Bloom filter!", std::to_string(bytes.size())};
+    }
+
+    // Return the restored filter
+    return filter;
+  }
+
+  /*-------------------------------------------------------------------------------------+--------*\
+  *| [public]: Accessors                                                                 | PUBLIC |*
+  \*-------------------------------------------------------------------------------------+--------*/
+
+  template <typename T, typename THash, typename TAllocator>
+  [[nodiscard]] auto BloomFilter<T, THash, TAllocator>::getBlockCount() const noexcept -> size
+  {
+    return m_blocks.size();
+  }
+
+  template <typename T, typename THash, typename TAllocator>
+  [[nodiscard]] auto BloomFilter<T, THash, TAllocator>::getByteCount() const noexcept -> size
+  {
+    return m_blocks.size() * sizeof(Block);
+  }
+
+  /*------------------------------------------------------------------------------------+---------*\
+  *| [private]: Constructors                                                            | PRIVATE |*
+  \*------------------------------------------------------------------------------------+---------*/
+
+  template <typename T, typename THash, typename TAllocator>
+  BloomFilter<T, THash, TAllocator>::BloomFilter(
+    const size blockCount, const TAllocator& allocator
+  )
+    : m_blocks(blockCount, Block{}, BlockAllocator{allocator})
+  {}
+
+  /*------------------------------------------------------------------------------------+---------*\
+  *| [private]: Methods                                                                 | PRIVATE |*
+  \*------------------------------------------------------------------------------------+---------*/
+
+  template <typename T, typename THash, typename TAllocator>
+  [[nodiscard]] auto BloomFilter<T, THash, TAllocator>::masksOf(const u64 hash) noexcept
+    -> arr<u64, 8>
+  {
+    // Pick one bit per word from the top six bits of a salted product of the low hash bits
+    const auto  low{static_cast<u32>(hash)};
+    arr<u64, 8> masks{};
+    for (size index{0}; index < masks.size(); ++index)
+    {
+      masks[index] = u64{1} << (static_cast<u32>(low * SALTS[index]) >> 26U);
+    }
+    return masks;
+  }
+
+  template <typename T, typename THash, typename TAllocator>
+  [[nodiscard]] auto BloomFilter<T, THash, TAllocator>::blockOf(const u64 hash) const noexcept
+    -> size
+  {
+    // Map the hash onto the blocks without a division through the high half of a 128-bit product
+#if defined(_MSC_VER)
+    u64 high{0};
+    static_cast<none>(_umul128(hash, static_cast<u64>(m_blocks.size()), &high));
+    return static_cast<size>(high);
+#else
+    __extension__ using Wide = unsigned __int128;
+    return static_cast<size>((Wide{hash} * static_cast<u64>(m_blocks.size())) >> 64U);
+#endif
+  }
+
+  // NOLINTEND(cppcoreguidelines-pro-bounds-constant-array-index)
+} // namespace fn::Probabilistic
+
+/*------------------------------------------------------------------------------------------------*\
+*| <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<< Promotes >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>> |*
+\*------------------------------------------------------------------------------------------------*/
+
+namespace fn
+{
+  /**
+   * @brief  A blocked Bloom filter for approximate set membership without false negatives.
+   * @tparam T The type of the keys.
+   * @tparam THash The type of the hash function. Defaults to `fn::Probabilistic::Hash<T>`.
+   * @tparam TAllocator The type of the allocator. Defaults to `std::allocator<T>`.
+   */
+  template <
+    typename T,
+    typename THash      = Probabilistic::Hash<T>,
+    typename TAllocator = std::allocator<T>>
+  using bloom = Probabilistic::BloomFilter<T, THash, TAllocator>;
+} // namespace fn
@@ -0,0 +1,612 @@
+#pragma once
+
+#include "Foundation/Probabilistic/Hash.ipp"
+#include "Foundation/Probabilistic/_internal/bytes.ipp"
+#include "Foundation/concepts.hpp"
+#include "Foundation/containers.hpp"
+#include "Foundation/errors.hpp"
+#include "Foundation/types.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <memory>
+#include <span>
+#include <utility>
+
+namespace fn::Probabilistic
+{
+  /**
+   * @brief   A cuckoo filter for approximate set membership that supports deletion.
+   * @details Stores a 16-bit fingerprint of every key in one of two candidate buckets of four
+   *          slots. A bucket is a single 64-bit word, so looking up a fingerprint in it is one
+   *          SWAR comparison instead of a loop. When both buckets are full, resident fingerprints
+   *          are relocated to their alternate bucket; a fingerprint that finds no place after
+   *          `MAX_KICKS` relocations is parked as a victim, and the filter reports itself full
+   *          until a deletion makes room again.
+   * @tparam  T The type of the keys.
+   * @tparam  THash The type of the hash function, which must return a well-mixed `u64`.
+   * @tparam  TAllocator The type of the allocator, rebound to the bucket type. Defaults to
+   *          `std::allocator<T>`.
+   * @warning Only erase keys that were inserted, otherwise a colliding key may be erased instead.
+   */
+  template <typename T, typename THash = Hash<T>, typename TAllocator = std::allocator<T>>
+  class CuckooFilter final
+  {
+  public:
+    /*-----------------------------------------------------------------------------------+--------*\
+    *| [public]: Constants                                                               | PUBLIC |*
+    \*-----------------------------------------------------------------------------------+--------*/
+
+    /**
+     * @brief The number of relocations tried before an insertion gives up.
+     */
+    static constexpr size MAX_KICKS{500};
+
+    /*-----------------------------------------------------------------------------------+--------*\
+    *| [public]: Constructors                                                            | PUBLIC |*
+    \*-----------------------------------------------------------------------------------+--------*/
+
+    /**
+     * @brief Constructs an empty filter with room for a number of keys.
+     * @param capacity The number of keys the filter must hold.
+     * @param allocator The allocator.
+     * @note  The bucket count is rounded up to a power of two at 95% load.
+     */
+    explicit CuckooFilter(size capacity, const TAllocator& allocator = {});
+
+    /*-----------------------------------------------------------------------------------+--------*\
+    *| [public]: Methods                                                                 | PUBLIC |*
+    \*-----------------------------------------------------------------------------------+--------*/
+
+    /**
+     * @brief   Inserts a key.
+     * @param   key The key to insert.
+     * @returns `false` if the filter is full and the key was not inserted.
+     */
+    [[nodiscard]] auto insert(const T& key) noexcept -> bln;
+
+    /**
+     * @brief   Checks whether a key may have been inserted.
+     * @param   key The key to check.
+     * @returns `false` if the key is not in the filter, `true` if it probably is.
+     */
+    [[nodiscard]] auto contains(const T& key) const noexcept -> bln;
+
+    /**
+     * @brief   Erases a previously inserted key.
+     * @param   key The key to erase.
+     * @returns Whether a matching fingerprint was found and erased.
+     */
+    auto erase(const T& key) noexcept -> bln;
+
+    /**
+     * @brief  Inserts every key of another filter into this filter.
+     * @param  other The filter to merge, sized identically.
+     * @throws ArgumentError If the filters have different sizes.
+     * @throws StateError If this filter becomes full.
+     * @note   Merges into a copy, so this filter is left unchanged if an exception is thrown.
+     */
+    auto merge(const CuckooFilter& other) -> none;
+
+    /**
+     * @brief Removes every key.
+     */
+    auto clear() noexcept -> none;
+
+    /**
+     * @brief   Serializes the filter into a portable little-endian byte buffer.
+     * @returns The serialized filter.
+     * @note    Only hosts that hash keys identically can share serialized filters.
+     */
+    [[nodiscard]] auto serialize() const -> vec<byte>;
+
+    /**
+     * @brief   Restores a filter serialized by `serialize`.
+     * @param   bytes The serialized filter.
+     * @param   allocator The allocator.
+     * @returns The restored filter.
+     * @throws  InputError If the bytes are not a serialized cuckoo filter, or the stored key count
+     *          does not match the stored fingerprints.
+     */
+    [[nodiscard]] static auto deserialize(
+      std::span<const byte> bytes, const TAllocator& allocator = {}
+    ) -> CuckooFilter;
+
+    /*-----------------------------------------------------------------------------------+--------*\
+    *| [public]: Accessors                                                               | PUBLIC |*
+    \*-----------------------------------------------------------------------------------+--------*/
+
+    /**
+     * @brief   Accessor for the number of stored keys.
+     * @returns The number of stored keys.
+     */
+    [[nodiscard]] auto getSize() const noexcept -> size;
+
+    /**
+     * @brief   Accessor for the number of buckets.
+     * @returns The number of buckets.
+     */
+    [[nodiscard]] auto getBucketCount() const noexcept -> size;
+
+    /**
+     * @brief   Accessor for the memory used by the fingerprints.
+     * @returns The number of bytes used by the fingerprints.
+     */
+    [[nodiscard]] auto getByteCount() const noexcept -> size;
+
+  private:
+    /*----------------------------------------------------------------------------------+---------*\
+    *| [private]: Constants                                                             | PRIVATE |*
+    \*----------------------------------------------------------------------------------+---------*/
+
+    static constexpr u32 MAGIC{0x46'4E'43'46};
+    static constexpr u64 LANES_LOW{0x00'01'00'01'00'01'00'01};
+    static constexpr u64 LANES_HIGH{0x80'00'80'00'80'00'80'00};
+    static constexpr u64 LANE_MASK{0xFF'FF};
+    static constexpr u64 LANE_BITS{16};
+    static constexpr f64 MAX_LOAD{0.95};
+
+    /*----------------------------------------------------------------------------------+---------*\
+    *| [private]: Types                                                                 | PRIVATE |*
+    \*----------------------------------------------------------------------------------+---------*/
+
+    using BucketAllocator = std::allocator_traits<TAllocator>::template rebind_alloc<u64>;
+
+    /**
+     * @brief A fingerprint that did not fit into the table.
+     */
+    struct Victim
+    {
+      size index{0};
+      u16  fingerprint{0};
+      bln  isUsed{false};
+    };
+
+    /*----------------------------------------------------------------------------------+---------*\
+    *| [private]: Fields                                                                | PRIVATE |*
+    \*----------------------------------------------------------------------------------+---------*/
+
+    vec<u64, BucketAllocator> m_buckets;
+    size                      m_size{0};
+    Victim                    m_victim;
+    u64                       m_random{0x9E'37'79'B9'7F'4A'7C'15};
+
+    /*----------------------------------------------------------------------------------+---------*\
+    *| [private]: Methods                                                               | PRIVATE |*
+    \*----------------------------------------------------------------------------------+---------*/
+
+    /**
+     * @brief Constructs an empty filter with an exact number of buckets.
+     * @param bucketCount The number of buckets, a power of two.
+     * @param allocator The allocator.
+     * @param tag Disambiguates from the public constructor.
+     */
+    CuckooFilter(size bucketCount, const TAllocator& allocator, unit tag);
+
+    /**
+     * @brief   Computes the primary bucket and the fingerprint of a key.
+     * @param   key The key.
+     * @returns The primary bucket and the non-zero fingerprint.
+     */
+    [[nodiscard]] auto locate(const T& key) const noexcept -> pair<size, u16>;
+
+    /**
+     * @brief   Computes the alternate bucket of a fingerprint.
+     * @param   index The current bucket.
+     * @param   fingerprint The fingerprint.
+     * @returns The other candidate bucket.
+     */
+    [[nodiscard]] auto alternate(size index, u16 fingerprint) const noexcept -> size;
+
+    /**
+     * @brief   Stores a fingerprint in one of its buckets, relocating others if necessary.
+     * @param   index One of the candidate buckets.
+     * @param   fingerprint The fingerprint.
+     * @returns `false` if the filter is full.
+     */
+    [[nodiscard]] auto place(size index, u16 fingerprint) noexcept -> bln;
+
+    /**
+     * @brief   Stores a fingerprint in a free slot of a bucket.
+     * @param   index The bucket.
+     * @param   fingerprint The fingerprint.
+     * @returns Whether the bucket had a free slot.
+     */
+    [[nodiscard]] auto tryPut(size index, u16 fingerprint) noexcept -> bln;
+
+    /**
+     * @brief   Removes one copy of a fingerprint from a bucket.
+     * @param   index The bucket.
+     * @param   fingerprint The fingerprint.
+     * @returns Whether the bucket held the fingerprint.
+     */
+    [[nodiscard]] auto tryRemove(size index, u16 fingerprint) noexcept -> bln;
+
+    /**
+     * @brief   Finds the lanes of a bucket equal to a fingerprint.
+     * @param   bucket The bucket.
+     * @param   fingerprint The fingerprint, zero for free slots.
+     * @returns A mask whose lowest set bit, if any, marks the first matching lane.
+     */
+    [[nodiscard]] static auto matchLanes(u64 bucket, u16 fingerprint) noexcept -> u64;
+  };
+} // namespace fn::Probabilistic
+
+/*------------------------------------------------------------------------------------------------*\
+*| <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<< Implementation >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>> |*
+\*------------------------------------------------------------------------------------------------*/
+
+namespace fn::Probabilistic
+{
+  /*-------------------------------------------------------------------------------------+--------*\
+  *| [public]: Constructors                                                              | PUBLIC |*
+  \*-------------------------------------------------------------------------------------+--------*/
+
+  template <typename T, typename THash, typename TAllocator>
+  CuckooFilter<T, THash, TAllocator>::CuckooFilter(
+    const size capacity, const TAllocator& allocator
+  )
+    : CuckooFilter{
+        std::bit_ceil(std::max<size>(
+          1, static_cast<size>(std::ceil(static_cast<f64>(capacity) / (4 * MAX_LOAD)))
+        )),
+        allocator,
+        unit{}
+      }
+  {}
+
+  /*-------------------------------------------------------------------------------------+--------*\
+  *| [public]: Methods                                                                   | PUBLIC |*
+  \*-------------------------------------------------------------------------------------+--------*/
+
+  template <typename T, typename THash, typename TAllocator>
+  [[nodiscard]] auto CuckooFilter<T, THash, TAllocator>::insert(const T& key) noexcept -> bln
+  {
+    const auto [index, fingerprint]{locate(key)};
+    return place(index, fingerprint);
+  }
+
+  template <typename T, typename THash, typename TAllocator>
+  [[nodiscard]] auto CuckooFilter<T, THash, TAllocator>::contains(const T& key) const noexcept
+    -> bln
+  {
+    const auto [index, fingerprint]{locate(key)};
+    const size other{alternate(index, fingerprint)};
+
+    // Check both candidate buckets at once
+    if ((matchLanes(m_buckets[index], fingerprint) | matchLanes(m_buckets[other], fingerprint))
+        != 0)
+    {
+      return true;
+    }
+
+    // Check the parked victim
+    return m_victim.isUsed and m_victim.fingerprint == fingerprint
+       and (m_victim.index == index or m_victim.index == other);
+  }
+
+  template <typename T, typename THash, typename TAllocator>
+  auto CuckooFilter<T, THash, TAllocator>::erase(const T& key) noexcept -> bln
+  {
+    const auto [index, fingerprint]{locate(key)};
+    const size other{alternate(index, fingerprint)};
+
+    // Remove the fingerprint from either candidate bucket
+    if (tryRemove(index, fingerprint) or tryRemove(other, fingerprint))
+    {
+      --m_size;
+
+      // Give the parked victim another chance now that there is room
+      if (m_victim.isUsed)
+      {
+        const Victim victim{std::exchange(m_victim, Victim{})};
+        --m_size;
+        static_cast<none>(place(victim.index, victim.fingerprint));
+      }
+      return true;
+    }
+
+    // Remove the parked victim
+    if (m_victim.isUsed and m_victim.fingerprint == fingerprint
+        and (m_victim.index == index or m_victim.index == other))
+    {
+      m_victim = Victim{};
+      --m_size;
+      return true;
+    }
+
+    // Nothing to erase
+    return false;
+  }
+
+  template <typename T, typename THash, typename TAllocator>
+  auto CuckooFilter<T, THash, TAllocator>::merge(const CuckooFilter& other) -> none
+  {
+    // Throw error if the filters have different sizes
+    if (other.m_buckets.size() != m_buckets.size())
+    {
+      throw ArgumentError{"Filter size mismatch!", std::to_string(other.m_buckets.size())};
+    }
+
+    // Re-place every fingerprint of the other filter into a copy of this filter
+    CuckooFilter merged{*this};
+    for (size index{0}; index < other.m_buckets.size(); ++index)
+    {
+      for (u64 bucket{other.m_buckets[index]}; bucket != 0; bucket >>= LANE_BITS)
+      {
+        if (const auto fingerprint{static_cast<u16>(bucket & LANE_MASK)};
+            fingerprint != 0 and not merged.place(index, fingerprint))
+        {
+          throw StateError{"Cuckoo filter is full!", std::to_string(merged.m_size)};
+        }
+      }
+    }
+    if (other.m_victim.isUsed
+        and not merged.place(other.m_victim.index, other.m_victim.fingerprint))
+    {
+      throw StateError{"Cuckoo filter is full!", std::to_string(merged.m_size)};
+    }
+
+    // Commit the merge
+    *this = std::move(merged);
+  }
+
+  template <typename T, typename THash, typename TAllocator>
+  auto CuckooFilter<T, THash, TAllocator>::clear() noexcept -> none
+  {
+    std::ranges::fill(m_buckets, u64{0});
+    m_size   = 0;
+    m_victim = Victim{};
+  }
+
+  template <typename T, typename THash, typename TAllocator>
+  [[nodiscard]] auto CuckooFilter<T, THash, TAllocator>::serialize() const -> vec<byte>
+  {
+    // Write the header
+    vec<byte> bytes;
+    bytes.reserve(31 + (m_buckets.size() * sizeof(u64)));
+    _internal::appendLittleEndian(bytes, MAGIC);
+    _internal::appendLittleEndian(bytes, static_cast<u64>(m_buckets.size()));
+    _internal::appendLittleEndian(bytes, static_cast<u64>(m_size));
+    _internal::appendLittleEndian(bytes, static_cast<u8>(m_victim.isUsed));
+    _internal::appendLittleEndian(bytes, static_cast<u64>(m_victim.index));
+    _internal::appendLittleEndian(bytes, m_victim.fingerprint);
+
+    // Write the fingerprints
+    for (const u64 bucket : m_buckets)
+    {
+      _internal::appendLittleEndian(bytes, bucket);
+    }
+
+    // Return the serialized filter
+    return bytes;
+  }
+
+  template <typename T, typename THash, typename TAllocator>
+  [[nodiscard]] auto CuckooFilter<T, THash, TAllocator>::deserialize(
+    const std::span<const byte> bytes, const TAllocator& allocator
+  ) -> CuckooFilter
+  {
+    _internal::ByteReader reader{bytes};
+
+    // Read the header
+    const auto magic{reader.template read<u32>()};
+    const auto bucketCount{reader.template read<u64>()};
+    const auto count{reader.template read<u64>()};
+    const auto isVictimUsed{reader.template read<u8>()};
+    const auto victimIndex{reader.template read<u64>()};
+    const auto victimFingerprint{reader.template read<u16>()};
+
+    // Throw error if the header does not belong to a cuckoo filter
+    if (magic != MAGIC or not std::has_single_bit(bucketCount) or isVictimUsed > 1
+        or victimIndex >= bucketCount or (bytes.size() - 31) / sizeof(u64) != bucketCount)
+    {
+      throw InputError{"Malformed cuckoo filter!", std::to_string(bytes.size())};
+    }
+
+    // Read the fingerprints and count the occupied lanes
+    CuckooFilter filter{static_cast<size>(bucketCount), allocator, unit{}};
+    u64          occupied{isVictimUsed};
+    for (u64& bucket : filter.m_buckets)
+    {
+      bucket = reader.template read<u64>();
+      for (u64 lanes{bucket}; lanes != 0; lanes >>= LANE_BITS)
+      {
+        occupied += static_cast<u64>((lanes & LANE_MASK) != 0);
+      }
+    }
+    filter.m_size   = static_cast<size>(count);
+    filter.m_victim = Victim{static_cast<size>(victimIndex), victimFingerprint, isVictimUsed == 1};
+
+    // Throw error if the key count or the victim disagrees with the fingerprints
+    if (occupied != count or (isVictimUsed == 1 and victimFingerprint == 0))
+    {
+      throw InputError{"Malformed cuckoo filter!", std::to_string(count)};
+    }
+
+    // Throw error if there are trailing bytes
+    if (not reader.isExhausted())
+    {
+      throw InputError{"Malformed cuckoo filter!", std::to_string(bytes.size())};
+    }
+
+    // Return the restored filter
+    return filter;
+  }
+
+  /*-------------------------------------------------------------------------------------+--------*\
+  *| [public]: Accessors                                                                 | PUBLIC |*
+  \*-------------------------------------------------------------------------------------+--------*/
+
+  template <typename T, typename THash, typename TAllocator>
+  [[nodiscard]] auto CuckooFilter<T, THash, TAllocator>::getSize() const noexcept -> size
+  {
+    return m_size;
+  }
+
+  template <typename T, typename THash, typename TAllocator>
+  [[nodiscard]] auto CuckooFilter<T, THash, TAllocator>::getBucketCount() const noexcept -> size
+  {
+    return m_buckets.size();
+  }
+
+  template <typename T, typename THash, typename TAllocator>
+  [[nodiscard]] auto CuckooFilter<T, THash, TAllocator>::getByteCount() const noexcept -> size
+  {
+    return m_buckets.size() * sizeof(u64);
+  }
+
+  /*------------------------------------------------------------------------------------+---------*\
+  *| [private]: Constructors                                                            | PRIVATE |*
+  \*------------------------------------------------------------------------------------+---------*/
+
+  template <typename T, typename THash, typename TAllocator>
+  CuckooFilter<T, THash, TAllocator>::CuckooFilter(
+    const size bucketCount, const TAllocator& allocator, unit /*tag*/
+  )
+    : m_buckets(bucketCount, u64{0}, BucketAllocator{allocator})
+  {}
+
+  /*------------------------------------------------------------------------------------+---------*\
+  *| [private]: Methods                                                                 | PRIVATE |*
+  \*------------------------------------------------------------------------------------+---------*/
+
+  template <typename T, typename THash, typename TAllocator>
+  [[nodiscard]] auto CuckooFilter<T, THash, TAllocator>::locate(const T& key) const noexcept
+    -> pair<size, u16>
+  {
+    // Take the bucket from the low and the fingerprint from the high hash bits
+    const u64  hash{THash{}(key)};
+    const auto bits{static_cast<u16>(hash >> 48U)};
+
+    // Map a zero fingerprint to one, since zero marks an empty slot
+    const u16 fingerprint{bits == 0 ? u16{1} : bits};
+    return {static_cast<size>(hash) & (m_buckets.size() - 1), fingerprint};
+  }
+
+  template <typename T, typename THash, typename TAllocator>
+  [[nodiscard]] auto CuckooFilter<T, THash, TAllocator>::alternate(
+    const size index, const u16 fingerprint
+  ) const noexcept -> size
+  {
+    // Use an involution so that both buckets lead to each other
+    return (index ^ static_cast<size>(_internal::mix64(fingerprint))) & (m_buckets.size() - 1);
+  }
+
+  template <typename T, typename THash, typename TAllocator>
+  [[nodiscard]] auto CuckooFilter<T, THash, TAllocator>::place(
+    const size index, const u16 fingerprint
+  ) noexcept -> bln
+  {
+    // Refuse to insert while a victim is parked
+    if (m_victim.isUsed)
+    {
+      return false;
+    }
+
+    // Store the fingerprint in either candidate bucket if possible
+    if (tryPut(index, fingerprint) or tryPut(alternate(index, fingerprint), fingerprint))
+    {
+      ++m_size;
+      return true;
+    }
+
+    // Relocate random residents until every fingerprint has a place
+    size current{index};
+    u16  homeless{fingerprint};
+    for (size kick{0}; kick < MAX_KICKS; ++kick)
+    {
+      // Swap the homeless fingerprint with a random resident
+      m_random ^= m_random << 13U;
+      m_random ^= m_random >> 7U;
+      m_random ^= m_random << 17U;
+      const u64 shift{(m_random & 3U) * LANE_BITS};
+      u64&      bucket{m_buckets[current]};
+      const auto resident{static_cast<u16>((bucket >> shift) & LANE_MASK)};
+      bucket   = (bucket & ~(LANE_MASK << shift)) | (static_cast<u64>(homeless) << shift);
+      homeless = resident;
+
+      // Move the evicted fingerprint to its alternate bucket
+      current = alternate(current, homeless);
+      if (tryPut(current, homeless))
+      {
+        ++m_size;
+        return true;
+      }
+    }
+
+    // Park the last homeless fingerprint, the filter is full from now on
+    m_victim = Victim{current, homeless, true};
+    ++m_size;
+    return true;
+  }
+
+  template <typename T, typename THash, typename TAllocator>
+  [[nodiscard]] auto CuckooFilter<T, THash, TAllocator>::tryPut(
+    const size index, const u16 fingerprint
+  ) noexcept -> bln
+  {
+    // Find the first free lane
+    u64&      bucket{m_buckets[index]};
+    const u64 free{matchLanes(bucket, 0)};
+    if (free == 0)
+    {
+      return false;
+    }
+
+    // Store the fingerprint in it
+    const auto shift{static_cast<u64>(std::countr_zero(free)) / LANE_BITS * LANE_BITS};
+    bucket |= static_cast<u64>(fingerprint) << shift;
+    return true;
+  }
+
+  template <typename T, typename THash, typename TAllocator>
+  [[nodiscard]] auto CuckooFilter<T, THash, TAllocator>::tryRemove(
+    const size index, const u16 fingerprint
+  ) noexcept -> bln
+  {
+    // Find the first matching lane
+    u64&      bucket{m_buckets[index]};
+    const u64 matches{matchLanes(bucket, fingerprint)};
+    if (matches == 0)
+    {
+      return false;
+    }
+
+    // Clear it
+    const auto shift{static_cast<u64>(std::countr_zero(matches)) / LANE_BITS * LANE_BITS};
+    bucket &= ~(LANE_MASK << shift);
+    return true;
+  }
+
+  template <typename T, typename THash, typename TAllocator>
+  [[nodiscard]] auto CuckooFilter<T, THash, TAllocator>::matchLanes(
+    const u64 bucket, const u16 fingerprint
+  ) noexcept -> u64
+  {
+    // Zero out the matching lanes and detect zero lanes with the classic SWAR test; borrows can
+    // only produce spurious marks above a genuine match, so the lowest mark is always exact
+    const u64 difference{bucket ^ (LANES_LOW * fingerprint)};
+    return (difference - LANES_LOW) & ~difference & LANES_HIGH;
+  }
+} // namespace fn::Probabilistic
+
+/*------------------------------------------------------------------------------------------------*\
+*| <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<< Promotes >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>> |*
+\*------------------------------------------------------------------------------------------------*/
+
+namespace fn
+{
+  /**
+   * @brief  A cuckoo filter for approximate set membership that supports deletion.
+   * @tparam T The type of the keys.
+   * @tparam THash The type of the hash function. Defaults to `fn::Probabilistic::Hash<T>`.
+   * @tparam TAllocator The type of the allocator. Defaults to `std::allocator<T>`.
+   */
+  template <
+    typename T,
+    typename THash      = Probabilistic::Hash<T>,
+    typename TAllocator = std::allocator<T>>
+  using cuckoo_filter = Probabilistic::CuckooFilter<T, THash, TAllocator>;
+} // namespace fn
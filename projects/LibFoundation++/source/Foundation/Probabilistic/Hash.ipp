@@ -0,0 +1,128 @@
+#pragma once
+
+#include "Foundation/concepts.hpp"
+#include "Foundation/types.hpp"
+
+#include <bit>
+#include <cstring>
+#include <functional>
+#include <type_traits>
+
+namespace fn::Probabilistic
+{
+  /**
+   * @brief   A fast 64-bit hash with full avalanche, suitable for deriving several independent
+   *          positions from a single hash value.
+   * @details Integral keys are hashed with a branch-free multiply-xorshift finalizer. Keys
+   *          convertible to `strv` and keys with unique object representations are hashed over
+   *          their bytes, eight bytes per step. Any other key is hashed with `std::hash` and then
+   *          finalized.
+   * @tparam  T The type of the keys.
+   */
+  template <typename T>
+  struct Hash
+  {
+    /**
+     * @brief   Hashes a key.
+     * @param   key The key to hash.
+     * @returns The hash of the key.
+     */
+    [[nodiscard]] auto operator()(const T& key) const noexcept -> u64;
+  };
+} // namespace fn::Probabilistic
+
+namespace fn::Probabilistic::_internal
+{
+  /**
+   * @brief   Scrambles the bits of a 64-bit value so that every input bit affects every output bit.
+   * @param   value The value to scramble.
+   * @returns The scrambled value.
+   */
+  [[nodiscard]] inline auto mix64(u64 value) noexcept -> u64;
+
+  /**
+   * @brief   Hashes a sequence of bytes.
+   * @param   data The first byte.
+   * @param   length The number of bytes.
+   * @returns The hash of the bytes.
+   */
+  [[nodiscard]] inline auto hashBytes(const void* data, size length) noexcept -> u64;
+} // namespace fn::Probabilistic::_internal
+
+/*------------------------------------------------------------------------------------------------*\
+*| <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<< Implementation >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>> |*
+\*------------------------------------------------------------------------------------------------*/
+
+namespace fn::Probabilistic::_internal
+{
+  // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+  [[nodiscard]] inline auto mix64(u64 value) noexcept -> u64
+  {
+    // Apply the finalizer of SplitMix64
+    value ^= value >> 30U;
+    value *= 0xBF'58'47'6D'1C'E4'E5'B9;
+    value ^= value >> 27U;
+    value *= 0x94'D0'49'BB'13'31'11'EB;
+    value ^= value >> 31U;
+    return value;
+  }
+
+  [[nodiscard]] inline auto hashBytes(const void* const data, const size length) noexcept -> u64
+  {
+    constexpr u64 MULTIPLIER{0x9E'37'79'B9'7F'4A'7C'15};
+
+    // Absorb the bytes eight at a time
+    const auto* bytes{static_cast<const cdef*>(data)};
+    u64         state{mix64(length ^ MULTIPLIER)};
+    size        offset{0};
+    for (; offset + sizeof(u64) <= length; offset += sizeof(u64))
+    {
+      u64 word{};
+      std::memcpy(&word, bytes + offset, sizeof(u64));
+      state = std::rotl((state ^ mix64(word)) * MULTIPLIER, 31);
+    }
+
+    // Absorb the remaining bytes zero-padded
+    if (offset < length)
+    {
+      u64 word{};
+      std::memcpy(&word, bytes + offset, length - offset);
+      state = std::rotl((state ^ mix64(word)) * MULTIPLIER, 31);
+    }
+
+    // Finalize the state
+    return mix64(state);
+  }
+
+  // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+} // namespace fn::Probabilistic::_internal
+
+namespace fn::Probabilistic
+{
+  template <typename T>
+  [[nodiscard]] auto Hash<T>::operator()(const T& key) const noexcept -> u64
+  {
+    if constexpr (IsIntegral<T> and sizeof(T) <= sizeof(u64))
+    {
+      // Finalize integral keys directly
+      return _internal::mix64(static_cast<u64>(key));
+    }
+    else if constexpr (std::is_convertible_v<const T&, strv>)
+    {
+      // Hash the characters of string-like keys
+      const strv text{key};
+      return _internal::hashBytes(text.data(), text.size());
+    }
+    else if constexpr (std::has_unique_object_representations_v<T>)
+    {
+      // Hash the bytes of keys whose equality is bitwise equality
+      return _internal::hashBytes(&key, sizeof(T));
+    }
+    else
+    {
+      // Finalize the standard hash of any other key
+      return _internal::mix64(static_cast<u64>(std::hash<T>{}(key)));
+    }
+  }
+} // namespace fn::Probabilistic
@@ -0,0 +1,326 @@
+#pragma once
+
+#include "Foundation/Probabilistic/Hash.ipp"
+#include "Foundation/Probabilistic/_internal/bytes.ipp"
+#include "Foundation/concepts.hpp"
+#include "Foundation/containers.hpp"
+#include "Foundation/errors.hpp"
+#include "Foundation/types.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <memory>
+#include <span>
+
+namespace fn::Probabilistic
+{
+  /**
+   * @brief   A HyperLogLog sketch that estimates the number of distinct keys in a stream.
+   * @details Keeps `2^precision` one-byte registers; the relative standard error of the estimate
+   *          is about `1.04 / sqrt(2^precision)`. Small cardinalities are estimated with linear
+   *          counting. As the hash is 64 bits wide, no large-range correction is needed.
+   * @tparam  T The type of the keys.
+   * @tparam  THash The type of the hash function, which must return a well-mixed `u64`.
+   * @tparam  TAllocator The type of the allocator, rebound to the register type. Defaults to
+   *          `std::allocator<T>`.
+   */
+  template <typename T, typename THash = Hash<T>, typename TAllocator = std::allocator<T>>
+  class HyperLogLog final
+  {
+  public:
+    /*-----------------------------------------------------------------------------------+--------*\
+    *| [public]: Constants                                                               | PUBLIC |*
+    \*-----------------------------------------------------------------------------------+--------*/
+
+    /**
+     * @brief The smallest supported precision.
+     */
+    static constexpr u8 MIN_PRECISION{4};
+
+    /**
+     * @brief The largest supported precision.
+     */
+    static constexpr u8 MAX_PRECISION{18};
+
+    /*-----------------------------------------------------------------------------------+--------*\
+    *| [public]: Constructors                                                            | PUBLIC |*
+    \*-----------------------------------------------------------------------------------+--------*/
+
+    /**
+     * @brief  Constructs an empty sketch.
+     * @param  precision The number of hash bits that select a register.
+     * @param  allocator The allocator.
+     * @throws ArgumentError If the precision is out of range.
+     */
+    explicit HyperLogLog(u8 precision = 14, const TAllocator& allocator = {});
+
+    /*-----------------------------------------------------------------------------------+--------*\
+    *| [public]: Methods                                                                 | PUBLIC |*
+    \*-----------------------------------------------------------------------------------+--------*/
+
+    /**
+     * @brief Adds a key to the sketch.
+     * @param key The key to add.
+     */
+    auto insert(const T& key) noexcept -> none;
+
+    /**
+     * @brief   Estimates the number of distinct keys added so far.
+     * @returns The estimated number of distinct keys.
+     */
+    [[nodiscard]] auto estimate() const noexcept -> f64;
+
+    /**
+     * @brief  Adds every key of another sketch to this sketch.
+     * @param  other The sketch to merge, of the same precision.
+     * @throws ArgumentError If the sketches have different precisions.
+     */
+    auto merge(const HyperLogLog& other) -> none;
+
+    /**
+     * @brief Removes every key.
+     */
+    auto clear() noexcept -> none;
+
+    /**
+     * @brief   Serializes the sketch into a portable byte buffer.
+     * @returns The serialized sketch.
+     * @note    Only hosts that hash keys identically can share serialized sketches.
+     */
+    [[nodiscard]] auto serialize() const -> vec<byte>;
+
+    /**
+     * @brief   Restores a sketch serialized by `serialize`.
+     * @param   bytes The serialized sketch.
+     * @param   allocator The allocator.
+     * @returns The restored sketch.
+     * @throws  InputError If the bytes are not a serialized HyperLogLog sketch.
+     */
+    [[nodiscard]] static auto deserialize(
+      std::span<const byte> bytes, const TAllocator& allocator = {}
+    ) -> HyperLogLog;
+
+    /*-----------------------------------------------------------------------------------+--------*\
+    *| [public]: Accessors                                                               | PUBLIC |*
+    \*-----------------------------------------------------------------------------------+--------*/
+
+    /**
+     * @brief   Accessor for the precision.
+     * @returns The precision.
+     */
+    [[nodiscard]] auto getPrecision() const noexcept -> u8;
+
+    /**
+     * @brief   Accessor for the memory used by the registers.
+     * @returns The number of bytes used by the registers.
+     */
+    [[nodiscard]] auto getByteCount() const noexcept -> size;
+
+  private:
+    /*----------------------------------------------------------------------------------+---------*\
+    *| [private]: Constants                                                             | PRIVATE |*
+    \*----------------------------------------------------------------------------------+---------*/
+
+    static constexpr u32 MAGIC{0x46'4E'48'4C};
+
+    /*----------------------------------------------------------------------------------+---------*\
+    *| [private]: Types                                                                 | PRIVATE |*
+    \*----------------------------------------------------------------------------------+---------*/
+
+    using RegisterAllocator = std::allocator_traits<TAllocator>::template rebind_alloc<u8>;
+
+    /*----------------------------------------------------------------------------------+---------*\
+    *| [private]: Fields                                                                | PRIVATE |*
+    \*----------------------------------------------------------------------------------+---------*/
+
+    u8                         m_precision;
+    vec<u8, RegisterAllocator> m_registers;
+  };
+} // namespace fn::Probabilistic
+
+/*------------------------------------------------------------------------------------------------*\
+*| <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<< Implementation >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>> |*
+\*------------------------------------------------------------------------------------------------*/
+
+namespace fn::Probabilistic
+{
+  /*-------------------------------------------------------------------------------------+--------*\
+  *| [public]: Constructors                                                              | PUBLIC |*
+  \*-------------------------------------------------------------------------------------+--------*/
+
+  template <typename T, typename THash, typename TAllocator>
+  HyperLogLog<T, THash, TAllocator>::HyperLogLog(const u8 precision, const TAllocator& allocator)
+    : m_precision{precision}
+    , m_registers{RegisterAllocator{allocator}}
+  {
+    // Throw error if the precision is out of range
+    if (precision < MIN_PRECISION or precision > MAX_PRECISION)
+    {
+      throw ArgumentError{"Precision out of range!", std::to_string(precision)};
+    }
+
+    // Allocate the registers
+    m_registers.resize(size{1} << precision);
+  }
+
+  /*-------------------------------------------------------------------------------------+--------*\
+  *| [public]: Methods                                                                   | PUBLIC |*
+  \*-------------------------------------------------------------------------------------+--------*/
+
+  template <typename T, typename THash, typename TAllocator>
+  auto HyperLogLog<T, THash, TAllocator>::insert(const T& key) noexcept -> none
+  {
+    // Select the register with the top bits and rank the rest by their leading zeros; the sentinel
+    // bit caps the rank for hashes whose remaining bits are all zero
+    const u64  hash{THash{}(key)};
+    const auto index{static_cast<size>(hash >> (64U - m_precision))};
+    const u64  rest{(hash << m_precision) | (u64{1} << (m_precision - 1U))};
+    const auto rank{static_cast<u8>(std::countl_zero(rest) + 1)};
+    m_registers[index] = std::max(m_registers[index], rank);
+  }
+
+  template <typename T, typename THash, typename TAllocator>
+  [[nodiscard]] auto HyperLogLog<T, THash, TAllocator>::estimate() const noexcept -> f64
+  {
+    // Accumulate the harmonic sum and the empty registers in one branch-free pass
+    f64  sum{0.0};
+    size zeros{0};
+    for (const u8 rank : m_registers)
+    {
+      sum += 1.0 / static_cast<f64>(u64{1} << rank);
+      zeros += rank == 0 ? 1 : 0;
+    }
+
+    // Compute the raw estimate with the bias constant of the register count
+    const auto count{static_cast<f64>(m_registers.size())};
+    const f64  alpha{
+      m_registers.size() == 16   ? 0.673
+       : m_registers.size() == 32 ? 0.697
+       : m_registers.size() == 64 ? 0.709
+                                  : 0.7213 / (1.0 + (1.079 / count))
+    };
+    const f64 raw{alpha * count * count / sum};
+
+    // Fall back to linear counting for small cardinalities
+    if (raw <= 2.5 * count and zeros != 0)
+    {
+      return count * std::log(count / static_cast<f64>(zeros));
+    }
+
+    // Return the raw estimate
+    return raw;
+  }
+
+  template <typename T, typename THash, typename TAllocator>
+  auto HyperLogLog<T, THash, TAllocator>::merge(const HyperLogLog& other) -> none
+  {
+    // Throw error if the sketches have different precisions
+    if (other.m_precision != m_precision)
+    {
+      throw ArgumentError{"Precision mismatch!", std::to_string(other.m_precision)};
+    }
+
+    // Keep the larger rank of every register
+    std::ranges::transform(
+      m_registers,
+      other.m_registers,
+      m_registers.begin(),
+      [](const u8 lhs, const u8 rhs)
+      {
+        return std::max(lhs, rhs);
+      }
+    );
+  }
+
+  template <typename T, typename THash, typename TAllocator>
+  auto HyperLogLog<T, THash, TAllocator>::clear() noexcept -> none
+  {
+    std::ranges::fill(m_registers, u8{0});
+  }
+
+  template <typename T, typename THash, typename TAllocator>
+  [[nodiscard]] auto HyperLogLog<T, THash, TAllocator>::serialize() const -> vec<byte>
+  {
+    // Write the header
+    vec<byte> bytes;
+    bytes.reserve(sizeof(u32) + sizeof(u8) + m_registers.size());
+    _internal::appendLittleEndian(bytes, MAGIC);
+    _internal::appendLittleEndian(bytes, m_precision);
+
+    // Write the registers
+    for (const u8 rank : m_registers)
+    {
+      bytes.push_back(static_cast<byte>(rank));
+    }
+
+    // Return the serialized sketch
+    return bytes;
+  }
+
+  template <typename T, typename THash, typename TAllocator>
+  [[nodiscard]] auto HyperLogLog<T, THash, TAllocator>::deserialize(
+    const std::span<const byte> bytes, const TAllocator& allocator
+  ) -> HyperLogLog
+  {
+    _internal::ByteReader reader{bytes};
+
+    // Throw error if the header does not belong to a HyperLogLog sketch
+    const auto magic{reader.template read<u32>()};
+    const auto precision{reader.template read<u8>()};
+    if (magic != MAGIC or precision < MIN_PRECISION or precision > MAX_PRECISION
+        or bytes.size() - sizeof(u32) - sizeof(u8) != size{1} << precision)
+    {
+      throw InputError{"Malformed HyperLogLog sketch!", std::to_string(bytes.size())};
+    }
+
+    // Read the registers
+    HyperLogLog sketch{precision, allocator};
+    for (u8& rank : sketch.m_registers)
+    {
+      rank = reader.template read<u8>();
+      if (rank > 65U - precision)
+      {
+        throw InputError{"Malformed HyperLogLog sketch!", std::to_string(rank)};
+      }
+    }
+
+    // Return the restored sketch
+    return sketch;
+  }
+
+  /*-------------------------------------------------------------------------------------+--------*\
+  *| [public]: Accessors                                                                 | PUBLIC |*
+  \*-------------------------------------------------------------------------------------+--------*/
+
+  template <typename T, typename THash, typename TAllocator>
+  [[nodiscard]] auto HyperLogLog<T, THash, TAllocator>::getPrecision() const noexcept -> u8
+  {
+    return m_precision;
+  }
+
+  template <typename T, typename THash, typename TAllocator>
+  [[nodiscard]] auto HyperLogLog<T, THash, TAllocator>::getByteCount() const noexcept -> size
+  {
+    return m_registers.size();
+  }
+} // namespace fn::Probabilistic
+
+/*------------------------------------------------------------------------------------------------*\
+*| <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<< Promotes >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>> |*
+\*------------------------------------------------------------------------------------------------*/
+
+namespace fn
+{
+  /**
+   * @brief  A HyperLogLog sketch that estimates the number of distinct keys in a stream.
+   * @tparam T The type of the keys.
+   * @tparam THash The type of the hash function. Defaults to `fn::Probabilistic::Hash<T>`.
+   * @tparam TAllocator The type of the allocator. Defaults to `std::allocator<T>`.
+   */
+  template <
+    typename T,
+    typename THash      = Probabilistic::Hash<T>,
+    typename TAllocator = std::allocator<T>>
+  using hll = Probabilistic::HyperLogLog<T, THash, TAllocator>;
+} // namespace fn
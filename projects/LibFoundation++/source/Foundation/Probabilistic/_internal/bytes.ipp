@@ -0,0 +1,98 @@
+#pragma once
+
+#include "Foundation/concepts.hpp"
+#include "Foundation/containers.hpp"
+#include "Foundation/errors.hpp"
+#include "Foundation/types.hpp"
+
+#include <span>
+
+namespace fn::Probabilistic::_internal
+{
+  /**
+   * @brief  Appends an unsigned integer to a byte buffer in little-endian byte order.
+   * @param  bytes The buffer to append to.
+   * @param  value The value to append.
+   * @tparam T The type of the value.
+   */
+  template <IsUnsigned T>
+  auto appendLittleEndian(vec<byte>& bytes, T value) -> none;
+
+  /**
+   * @brief A cursor that reads little-endian unsigned integers from a byte buffer.
+   */
+  class ByteReader final
+  {
+  public:
+    /**
+     * @brief Constructs a reader at the beginning of a byte buffer.
+     * @param bytes The buffer to read from.
+     */
+    explicit ByteReader(std::span<const byte> bytes) noexcept;
+
+    /**
+     * @brief   Reads the next unsigned integer in little-endian byte order.
+     * @tparam  T The type of the value.
+     * @returns The value.
+     * @throws  InputError If the buffer ends before the value.
+     */
+    template <IsUnsigned T>
+    [[nodiscard]] auto read() -> T;
+
+    /**
+     * @brief   Accessor for whether the whole buffer was read.
+     * @returns Whether there are no bytes left.
+     */
+    [[nodiscard]] auto isExhausted() const noexcept -> bln;
+
+  private:
+    std::span<const byte> m_bytes;
+  };
+} // namespace fn::Probabilistic::_internal
+
+/*------------------------------------------------------------------------------------------------*\
+*| <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<< Implementation >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>> |*
+\*------------------------------------------------------------------------------------------------*/
+
+namespace fn::Probabilistic::_internal
+{
+  template <IsUnsigned T>
+  auto appendLittleEndian(vec<byte>& bytes, const T value) -> none
+  {
+    // Append the bytes from the least significant one
+    for (size index{0}; index < sizeof(T); ++index)
+    {
+      bytes.push_back(static_cast<byte>(static_cast<u64>(value) >> (index * 8)));
+    }
+  }
+
+  inline ByteReader::ByteReader(const std::span<const byte> bytes) noexcept
+    : m_bytes{bytes}
+  {}
+
+  template <IsUnsigned T>
+  [[nodiscard]] auto ByteReader::read() -> T
+  {
+    // Throw error if the buffer ends before the value
+    if (m_bytes.size() < sizeof(T))
+    {
+      throw InputError{"Truncated input!", std::to_string(m_bytes.size())};
+    }
+
+    // Assemble the value from the least significant byte
+    u64 value{0};
+    for (size index{0}; index < sizeof(T); ++index)
+    {
+      value |= static_cast<u64>(m_bytes[index]) << (index * 8);
+    }
+    m_bytes = m_bytes.subspan(sizeof(T));
+
+    // Return the value
+    return static_cast<T>(value);
+  }
+
+  [[nodiscard]] inline auto ByteReader::isExhausted() const noexcept -> bln
+  {
+    return m_bytes.empty();
+  }
+} // namespace fn::Probabilistic::_internal
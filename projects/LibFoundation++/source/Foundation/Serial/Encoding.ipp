@@ -0,0 +1,24 @@
+#pragma once
+
+#include "Foundation/types.hpp"
+
+namespace fn::Serial
+{
+  /**
+   * @brief The encodings of integers in a serialized buffer.
+   */
+  enum class Encoding : u8
+  {
+    /**
+     * @brief Integers and lengths are stored at their full width and natural alignment, so that
+     *        every contiguous block can be viewed in place.
+     */
+    FIXED,
+
+    /**
+     * @brief Integers wider than a byte and lengths are stored as LEB128 varints, signed integers
+     *        zigzag-encoded first. Blocks of such integers can no longer be viewed in place.
+     */
+    VARINT
+  };
+} // namespace fn::Serial
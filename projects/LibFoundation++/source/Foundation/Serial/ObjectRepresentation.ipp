@@ -0,0 +1,25 @@
+#pragma once
+
+#include "Foundation/types.hpp"
+
+namespace fn::Serial
+{
+  /**
+   * @brief   Trait to opt a trivially copyable class into being serialized as its object
+   *          representation, which is copied without inspecting it.
+   * @details Specialize it with `IS_ENABLED` set to `true` only for classes whose every byte
+   *          pattern is a valid value, so that a malformed buffer cannot produce an invalid object:
+   *          no padding and no floating-point members, whose bytes are not determined by their
+   *          value, and no boolean, pointer or reference members, which have invalid patterns.
+   *          Other classes are written member by member, e.g. as tuples.
+   * @tparam  T The class.
+   */
+  template <typename T>
+  struct ObjectRepresentation
+  {
+    /**
+     * @brief Whether the class is serialized as its object representation.
+     */
+    static constexpr bln IS_ENABLED{false};
+  };
+} // namespace fn::Serial
@@ -0,0 +1,425 @@
+#pragma once
+
+#include "Foundation/Serial/Encoding.ipp"
+#include "Foundation/Serial/ObjectRepresentation.ipp"
+#include "Foundation/Serial/_internal/concepts.hpp"
+#include "Foundation/concepts.hpp"
+#include "Foundation/constants.hpp"
+#include "Foundation/errors.hpp"
+#include "Foundation/types.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <ranges>
+#include <span>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace fn::Serial
+{
+  /**
+   * @brief   A reader that deserializes values from a buffer written by `Writer`, or views them in
+   *          place.
+   * @details Values must be read with the types they were written with, in the same order.
+   *          Reading a `strv` or `std::span<const T>` returns a view into the buffer instead of a
+   *          copy, so a memory-mapped file can be accessed without deserializing it. Every read is
+   *          bounds checked, so a malformed buffer can neither be read past its end nor make the
+   *          reader allocate more elements than it holds bytes.
+   * @tparam  encoding The encoding of integers and lengths, which must match the writer.
+   * @warning Views refer to the buffer, which must outlive them.
+   */
+  template <Encoding encoding = Encoding::FIXED>
+  class Reader final
+  {
+    static_assert(std::endian::native == std::endian::little, "The host must be little-endian!");
+
+  public:
+    /*-----------------------------------------------------------------------------------+--------*\
+    *| [public]: Constructors                                                            | PUBLIC |*
+    \*-----------------------------------------------------------------------------------+--------*/
+
+    /**
+     * @brief Constructs a reader at the beginning of a buffer.
+     * @param bytes The buffer to read from. Alignment padding is relative to its first byte, so it
+     *              must be aligned as strictly as any viewed value.
+     */
+    explicit Reader(std::span<const byte> bytes) noexcept;
+
+    /*-----------------------------------------------------------------------------------+--------*\
+    *| [public]: Methods                                                                 | PUBLIC |*
+    \*-----------------------------------------------------------------------------------+--------*/
+
+    /**
+     * @brief   Reads the next value from the buffer.
+     * @tparam  T The type the value was written as, or a `strv` or `std::span<const T>` to view a
+     *          written block in place.
+     * @returns The value.
+     * @throws  InputError If the buffer ends before the value, the value is malformed or a viewed
+     *          block is misaligned in memory.
+     */
+    template <typename T>
+    [[nodiscard]] auto read() -> T;
+
+    /*-----------------------------------------------------------------------------------+--------*\
+    *| [public]: Accessors                                                               | PUBLIC |*
+    \*-----------------------------------------------------------------------------------+--------*/
+
+    /**
+     * @brief   Accessor for the number of bytes read so far.
+     * @returns The offset of the next value.
+     */
+    [[nodiscard]] auto getOffset() const noexcept -> size;
+
+    /**
+     * @brief   Accessor for whether the whole buffer was read.
+     * @returns Whether there are no bytes left.
+     */
+    [[nodiscard]] auto isExhausted() const noexcept -> bln;
+
+  private:
+    /*----------------------------------------------------------------------------------+---------*\
+    *| [private]: Methods                                                               | PRIVATE |*
+    \*----------------------------------------------------------------------------------+---------*/
+
+    [[nodiscard]] auto take(size count) -> const byte*;
+    auto               skip(size alignment) -> none;
+    [[nodiscard]] auto readVarint() -> u64;
+    [[nodiscard]] auto readLength(size minimumByteCount) -> size;
+    auto               checkBooleans(std::span<const byte> bytes) const -> none;
+
+    template <_internal::IsScalar T>
+    [[nodiscard]] auto readScalar() -> T;
+
+    /*----------------------------------------------------------------------------------+---------*\
+    *| [private]: Fields                                                                | PRIVATE |*
+    \*----------------------------------------------------------------------------------+---------*/
+
+    std::span<const byte> m_bytes;
+    size                  m_offset{0};
+  };
+} // namespace fn::Serial
+
+/*------------------------------------------------------------------------------------------------*\
+*| <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<< Implementation >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>> |*
+\*------------------------------------------------------------------------------------------------*/
+
+namespace fn::Serial
+{
+  // NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast)
+  // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+  /*-------------------------------------------------------------------------------------+--------*\
+  *| [public]: Constructors                                                              | PUBLIC |*
+  \*-------------------------------------------------------------------------------------+--------*/
+
+  template <Encoding encoding>
+  Reader<encoding>::Reader(const std::span<const byte> bytes) noexcept
+    : m_bytes{bytes}
+  {}
+
+  /*-------------------------------------------------------------------------------------+--------*\
+  *| [public]: Methods                                                                   | PUBLIC |*
+  \*-------------------------------------------------------------------------------------+--------*/
+
+  template <Encoding encoding>
+  template <typename T>
+  [[nodiscard]] auto Reader<encoding>::read() -> T
+  {
+    if constexpr (_internal::IsScalar<T>)
+    {
+      return readScalar<T>();
+    }
+    else if constexpr (_internal::IsOptional<T>)
+    {
+      // Read the value if the presence byte is set
+      if (not readScalar<bln>())
+      {
+        return nopt;
+      }
+      return read<typename T::value_type>();
+    }
+    else if constexpr (_internal::IsView<T>)
+    {
+      using Value = T::value_type;
+      static_assert(_internal::IsDense<Value>, "The type is not serializable!");
+      static_assert(
+        encoding == Encoding::FIXED or not _internal::IsCompressible<Value>,
+        "Varint-encoded blocks cannot be viewed!"
+      );
+
+      // Throw error if the block is misaligned in memory
+      const size length{readLength(sizeof(Value))};
+      skip(alignof(Value));
+      const byte* const data{take(length * sizeof(Value))};
+      if (reinterpret_cast<uptr>(data) % alignof(Value) != 0)
+      {
+        throw InputError{"Misaligned block!", std::to_string(m_offset)};
+      }
+
+      // Throw error if a boolean is neither false nor true
+      if constexpr (IsSameAs<bln, Value>)
+      {
+        checkBooleans({data, length});
+      }
+
+      // Return a view of the block
+      return T{reinterpret_cast<const Value*>(data), length};
+    }
+    else if constexpr (_internal::IsBlock<T>)
+    {
+      using Value = std::ranges::range_value_t<T>;
+
+      T value{};
+      if constexpr (encoding == Encoding::VARINT and _internal::IsCompressible<Value>)
+      {
+        // Read compressible integers one by one
+        const size length{readLength(1)};
+        value.reserve(length);
+        for (size index{0}; index < length; ++index)
+        {
+          value.push_back(readScalar<Value>());
+        }
+      }
+      else
+      {
+        // Locate the aligned block
+        const size length{readLength(sizeof(Value))};
+        skip(alignof(Value));
+        const byte* const data{take(length * sizeof(Value))};
+
+        // Throw error if a boolean is neither false nor true
+        if constexpr (IsSameAs<bln, Value>)
+        {
+          checkBooleans({data, length});
+        }
+
+        // Copy the values at once
+        value.resize(length);
+        if (length != 0)
+        {
+          std::memcpy(std::ranges::data(value), data, length * sizeof(Value));
+        }
+      }
+
+      // Return the block
+      return value;
+    }
+    else if constexpr (_internal::IsTupleLike<T>)
+    {
+      // Read the elements in order; braced initialization sequences the reads
+      return [this]<size... indices>(std::index_sequence<indices...>)
+      {
+        return T{read<std::tuple_element_t<indices, T>>()...};
+      }(std::make_index_sequence<std::tuple_size_v<T>>{});
+    }
+    else if constexpr (_internal::IsSequence<T>)
+    {
+      using Element = _internal::Element<std::ranges::range_value_t<T>>::Type;
+
+      // Reserve the elements if possible, each of which takes at least one byte
+      T          value{};
+      const size length{readLength(1)};
+      if constexpr (requires { value.reserve(length); })
+      {
+        value.reserve(length);
+      }
+
+      // Read the elements, appending them in the order they were written
+      if constexpr (requires { value.emplace_back(read<Element>()); })
+      {
+        for (size index{0}; index < length; ++index)
+        {
+          value.emplace_back(read<Element>());
+        }
+      }
+      else if constexpr (requires { value.emplace_hint(value.end(), read<Element>()); })
+      {
+        for (size index{0}; index < length; ++index)
+        {
+          value.emplace_hint(value.end(), read<Element>());
+        }
+      }
+      else
+      {
+        auto tail{value.before_begin()};
+        for (size index{0}; index < length; ++index)
+        {
+          tail = value.emplace_after(tail, read<Element>());
+        }
+      }
+
+      // Return the sequence
+      return value;
+    }
+    else
+    {
+      static_assert(IsNotSameAs<fmax, T>, "Extended-precision floats are not portable!");
+      static_assert(_internal::IsTrivial<T>, "The type is not serializable!");
+
+      // Copy the object representation
+      skip(alignof(T));
+      T value;
+      std::memcpy(&value, take(sizeof(T)), sizeof(T));
+      return value;
+    }
+  }
+
+  /*-------------------------------------------------------------------------------------+--------*\
+  *| [public]: Accessors                                                                 | PUBLIC |*
+  \*-------------------------------------------------------------------------------------+--------*/
+
+  template <Encoding encoding>
+  [[nodiscard]] auto Reader<encoding>::getOffset() const noexcept -> size
+  {
+    return m_offset;
+  }
+
+  template <Encoding encoding>
+  [[nodiscard]] auto Reader<encoding>::isExhausted() const noexcept -> bln
+  {
+    return m_offset == m_bytes.size();
+  }
+
+  /*------------------------------------------------------------------------------------+---------*\
+  *| [private]: Methods                                                                 | PRIVATE |*
+  \*------------------------------------------------------------------------------------+---------*/
+
+  template <Encoding encoding>
+  [[nodiscard]] auto Reader<encoding>::take(const size count) -> const byte*
+  {
+    // Throw error if the buffer ends before the bytes
+    if (count > m_bytes.size() - m_offset)
+    {
+      throw InputError{"Truncated input!", std::to_string(m_offset)};
+    }
+
+    // Advance past the bytes
+    const byte* const data{m_bytes.data() + m_offset};
+    m_offset += count;
+    return data;
+  }
+
+  template <Encoding encoding>
+  auto Reader<encoding>::skip(const size alignment) -> none
+  {
+    static_cast<none>(take((alignment - (m_offset % alignment)) % alignment));
+  }
+
+  template <Encoding encoding>
+  [[nodiscard]] auto Reader<encoding>::readVarint() -> u64
+  {
+    // Gather seven bits per byte until a byte without the continuation flag
+    u64 value{0};
+    for (u32 shift{0}; shift < 64; shift += 7)
+    {
+      const auto part{static_cast<u64>(*take(1))};
+      if (shift == 63 and part > 1)
+      {
+        break;
+      }
+      value |= (part & 0x7FU) << shift;
+      if ((part & 0x80U) == 0)
+      {
+        return value;
+      }
+    }
+
+    // Throw error if the varint does not fit 64 bits
+    throw InputError{"Malformed varint!", std::to_string(m_offset)};
+  }
+
+  template <Encoding encoding>
+  [[nodiscard]] auto Reader<encoding>::readLength(const size minimumByteCount) -> size
+  {
+    // Read the length
+    u64 length{0};
+    if constexpr (encoding == Encoding::VARINT)
+    {
+      length = readVarint();
+    }
+    else
+    {
+      length = readScalar<u64>();
+    }
+
+    // Throw error if the remaining bytes cannot hold the elements
+    if (length > (m_bytes.size() - m_offset) / minimumByteCount)
+    {
+      throw InputError{"Truncated input!", std::to_string(length)};
+    }
+
+    // Return the length
+    return static_cast<size>(length);
+  }
+
+  template <Encoding encoding>
+  auto Reader<encoding>::checkBooleans(const std::span<const byte> bytes) const -> none
+  {
+    // Throw error if a boolean is neither false nor true
+    const auto isMalformed{[](const byte bit)
+                           {
+                             return bit > byte{1};
+                           }};
+    if (std::ranges::any_of(bytes, isMalformed))
+    {
+      throw InputError{"Malformed boolean!", std::to_string(m_offset)};
+    }
+  }
+
+  template <Encoding encoding>
+  template <_internal::IsScalar T>
+  [[nodiscard]] auto Reader<encoding>::readScalar() -> T
+  {
+    if constexpr (encoding == Encoding::VARINT and _internal::IsCompressible<T>)
+    {
+      using Integer = _internal::Underlying<T>::Type;
+
+      // Decode signed integers from zigzag
+      const u64 raw{readVarint()};
+      const auto integer{[raw]
+                         {
+                           if constexpr (IsSigned<Integer>)
+                           {
+                             return static_cast<i64>(raw >> 1U) ^ -static_cast<i64>(raw & 1U);
+                           }
+                           else
+                           {
+                             return raw;
+                           }
+                         }()};
+
+      // Throw error if the integer does not fit the type
+      if (not std::in_range<Integer>(integer))
+      {
+        throw InputError{"Malformed varint!", std::to_string(m_offset)};
+      }
+
+      // Return the value
+      return static_cast<T>(static_cast<Integer>(integer));
+    }
+    else
+    {
+      // Throw error if a boolean is neither false nor true
+      skip(alignof(T));
+      const byte* const data{take(sizeof(T))};
+      if constexpr (IsSameAs<bln, T>)
+      {
+        if (*data > byte{1})
+        {
+          throw InputError{"Malformed boolean!", std::to_string(m_offset)};
+        }
+      }
+
+      // Copy the aligned object representation
+      T value;
+      std::memcpy(&value, data, sizeof(T));
+      return value;
+    }
+  }
+
+  // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+  // NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast)
+} // namespace fn::Serial
@@ -0,0 +1,292 @@
+#pragma once
+
+#include "Foundation/Serial/Encoding.ipp"
+#include "Foundation/Serial/ObjectRepresentation.ipp"
+#include "Foundation/Serial/_internal/concepts.hpp"
+#include "Foundation/concepts.hpp"
+#include "Foundation/containers.hpp"
+#include "Foundation/types.hpp"
+
+#include <bit>
+#include <cstring>
+#include <ranges>
+#include <span>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace fn::Serial
+{
+  /**
+   * @brief   A writer that serializes values into a schema-free, little-endian, aligned buffer.
+   * @details The layout follows from the written types alone, so values must be read back with the
+   *          same types in the same order:
+   *          - Arithmetic values and enumerators are stored at their natural alignment, relative
+   *            to the start of the buffer, and padded with zeros. `fmax` is rejected, since its
+   *            representation differs between platforms.
+   *          - Resizable and viewed blocks of scalars or of the classes below, such as
+   *            `vec<f32>`, `str`, `std::span` or `strv`, are stored as a length followed by the
+   *            aligned values, copied at once. Readers can view them in place.
+   *          - Optional values are stored as a presence byte followed by the value.
+   *          - Pairs, tuples and arrays are stored as their elements in order.
+   *          - Other ranges, such as `map`, `umap` or `vec<str>`, are stored as a length followed
+   *            by their elements in iteration order.
+   *          - Trivially copyable classes without padding that are opted in with
+   *            `ObjectRepresentation` are stored as their aligned object representation.
+   * @tparam  encoding The encoding of integers and lengths.
+   * @note    Only little-endian hosts are supported, on which the format matches the native layout.
+   */
+  template <Encoding encoding = Encoding::FIXED>
+  class Writer final
+  {
+    static_assert(std::endian::native == std::endian::little, "The host must be little-endian!");
+
+  public:
+    /*-----------------------------------------------------------------------------------+--------*\
+    *| [public]: Methods                                                                 | PUBLIC |*
+    \*-----------------------------------------------------------------------------------+--------*/
+
+    /**
+     * @brief   Appends a value to the buffer.
+     * @param   value The value to append.
+     * @tparam  T The type of the value.
+     * @returns The writer, for chaining.
+     */
+    template <typename T>
+    auto write(const T& value) -> Writer&;
+
+    /**
+     * @brief Reserves space for a number of bytes in the buffer.
+     * @param count The number of bytes.
+     */
+    auto reserve(size count) -> none;
+
+    /**
+     * @brief Removes every value while keeping the allocated buffer.
+     */
+    auto clear() noexcept -> none;
+
+    /**
+     * @brief   Moves the buffer out of the writer, leaving it empty.
+     * @returns The serialized buffer.
+     */
+    [[nodiscard]] auto release() noexcept -> vec<byte>;
+
+    /*-----------------------------------------------------------------------------------+--------*\
+    *| [public]: Accessors                                                               | PUBLIC |*
+    \*-----------------------------------------------------------------------------------+--------*/
+
+    /**
+     * @brief   Accessor for the serialized bytes.
+     * @returns The bytes written so far.
+     */
+    [[nodiscard]] auto getBytes() const noexcept -> std::span<const byte>;
+
+  private:
+    /*----------------------------------------------------------------------------------+---------*\
+    *| [private]: Methods                                                               | PRIVATE |*
+    \*----------------------------------------------------------------------------------+---------*/
+
+    auto append(const none* data, size count) -> none;
+    auto pad(size alignment) -> none;
+    auto writeVarint(u64 value) -> none;
+    auto writeLength(size length) -> none;
+
+    template <_internal::IsScalar T>
+    auto writeScalar(T value) -> none;
+
+    /*----------------------------------------------------------------------------------+---------*\
+    *| [private]: Fields                                                                | PRIVATE |*
+    \*----------------------------------------------------------------------------------+---------*/
+
+    vec<byte> m_bytes;
+  };
+} // namespace fn::Serial
+
+/*------------------------------------------------------------------------------------------------*\
+*| <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<< Implementation >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>> |*
+\*------------------------------------------------------------------------------------------------*/
+
+namespace fn::Serial
+{
+  /*-------------------------------------------------------------------------------------+--------*\
+  *| [public]: Methods                                                                   | PUBLIC |*
+  \*-------------------------------------------------------------------------------------+--------*/
+
+  template <Encoding encoding>
+  template <typename T>
+  auto Writer<encoding>::write(const T& value) -> Writer&
+  {
+    if constexpr (_internal::IsScalar<T>)
+    {
+      writeScalar(value);
+    }
+    else if constexpr (_internal::IsOptional<T>)
+    {
+      // Write the presence byte, then the value if present
+      writeScalar(value.has_value());
+      if (value.has_value())
+      {
+        write(value.value());
+      }
+    }
+    else if constexpr (_internal::IsBlock<T>)
+    {
+      using Value = std::ranges::range_value_t<T>;
+
+      // Write the length
+      const auto length{static_cast<size>(std::ranges::size(value))};
+      writeLength(length);
+
+      // Write compressible integers one by one, anything else with a single copy
+      if constexpr (encoding == Encoding::VARINT and _internal::IsCompressible<Value>)
+      {
+        for (const Value element : value)
+        {
+          writeScalar(element);
+        }
+      }
+      else
+      {
+        pad(alignof(Value));
+        append(std::ranges::data(value), length * sizeof(Value));
+      }
+    }
+    else if constexpr (_internal::IsTupleLike<T>)
+    {
+      // Write the elements in order
+      std::apply(
+        [this](const auto&... elements)
+        {
+          (write(elements), ...);
+        },
+        value
+      );
+    }
+    else if constexpr (_internal::IsSequence<T>)
+    {
+      // Write the length, then the elements in iteration order
+      writeLength(static_cast<size>(std::ranges::distance(value)));
+      for (const auto& element : value)
+      {
+        write(element);
+      }
+    }
+    else
+    {
+      static_assert(IsNotSameAs<fmax, T>, "Extended-precision floats are not portable!");
+      static_assert(_internal::IsTrivial<T>, "The type is not serializable!");
+
+      // Write the object representation
+      pad(alignof(T));
+      append(&value, sizeof(T));
+    }
+
+    // Return the writer
+    return *this;
+  }
+
+  template <Encoding encoding>
+  auto Writer<encoding>::reserve(const size count) -> none
+  {
+    m_bytes.reserve(count);
+  }
+
+  template <Encoding encoding>
+  auto Writer<encoding>::clear() noexcept -> none
+  {
+    m_bytes.clear();
+  }
+
+  template <Encoding encoding>
+  [[nodiscard]] auto Writer<encoding>::release() noexcept -> vec<byte>
+  {
+    return std::exchange(m_bytes, {});
+  }
+
+  /*-------------------------------------------------------------------------------------+--------*\
+  *| [public]: Accessors                                                                 | PUBLIC |*
+  \*-------------------------------------------------------------------------------------+--------*/
+
+  template <Encoding encoding>
+  [[nodiscard]] auto Writer<encoding>::getBytes() const noexcept -> std::span<const byte>
+  {
+    return m_bytes;
+  }
+
+  /*------------------------------------------------------------------------------------+---------*\
+  *| [private]: Methods                                                                 | PRIVATE |*
+  \*------------------------------------------------------------------------------------+---------*/
+
+  template <Encoding encoding>
+  auto Writer<encoding>::append(const none* const data, const size count) -> none
+  {
+    // Grow the buffer and copy the bytes at once
+    const size offset{m_bytes.size()};
+    m_bytes.resize(offset + count);
+    if (count != 0)
+    {
+      std::memcpy(m_bytes.data() + offset, data, count);
+    }
+  }
+
+  template <Encoding encoding>
+  auto Writer<encoding>::pad(const size alignment) -> none
+  {
+    // Pad with zeros up to the next multiple of the alignment
+    m_bytes.resize((m_bytes.size() + alignment - 1) / alignment * alignment);
+  }
+
+  template <Encoding encoding>
+  auto Writer<encoding>::writeVarint(u64 value) -> none
+  {
+    // Write seven bits per byte from the least significant ones, flagging every byte but the last
+    while (value >= 0x80U)
+    {
+      m_bytes.push_back(static_cast<byte>(value | 0x80U));
+      value >>= 7U;
+    }
+    m_bytes.push_back(static_cast<byte>(value));
+  }
+
+  template <Encoding encoding>
+  auto Writer<encoding>::writeLength(const size length) -> none
+  {
+    if constexpr (encoding == Encoding::VARINT)
+    {
+      writeVarint(length);
+    }
+    else
+    {
+      writeScalar(static_cast<u64>(length));
+    }
+  }
+
+  template <Encoding encoding>
+  template <_internal::IsScalar T>
+  auto Writer<encoding>::writeScalar(const T value) -> none
+  {
+    if constexpr (encoding == Encoding::VARINT and _internal::IsCompressible<T>)
+    {
+      using Integer = _internal::Underlying<T>::Type;
+
+      // Write unsigned integers as they are and signed integers zigzag-encoded
+      const auto integer{static_cast<Integer>(value)};
+      if constexpr (IsSigned<Integer>)
+      {
+        const auto wide{static_cast<i64>(integer)};
+        writeVarint((static_cast<u64>(wide) << 1U) ^ static_cast<u64>(wide >> 63U));
+      }
+      else
+      {
+        writeVarint(static_cast<u64>(integer));
+      }
+    }
+    else
+    {
+      // Write the aligned object representation
+      pad(alignof(T));
+      append(&value, sizeof(T));
+    }
+  }
+} // namespace fn::Serial
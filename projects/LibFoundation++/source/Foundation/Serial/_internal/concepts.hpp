@@ -0,0 +1,118 @@
+#pragma once
+
+#include "Foundation/Serial/ObjectRepresentation.ipp"
+#include "Foundation/concepts.hpp"
+
+#include "Foundation/types.hpp"
+#include "Foundation/utilities.hpp"
+
+#include <ranges>
+#include <span>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+
+namespace fn::Serial::_internal
+{
+  /**
+   * @brief Concept to check if a type is a character type.
+   */
+  template <typename T>
+  concept IsCharacter = AreSameAs<T, cdef> or AreSameAs<T, wchar_t> or AreSameAs<T, char8_t>
+                     or AreSameAs<T, char16_t> or AreSameAs<T, char32_t>;
+
+  /**
+   * @brief Concept to check if a type is serialized as a single arithmetic value or enumerator,
+   *        excluding extended-precision floats, whose representation differs between platforms.
+   */
+  template <typename T>
+  concept IsScalar = (IsArithmetic<T> and IsNotSameAs<fmax, T>) or IsEnum<T>;
+
+  /**
+   * @brief Concept to check if a type is an integer that the varint encoding compresses.
+   */
+  template <typename T>
+  concept IsCompressible =
+    (IsIntegral<T> and IsNotSameAs<bln, T> and not IsCharacter<T> and sizeof(T) > 1)
+    or (IsEnum<T> and IsIntegral<std::underlying_type_t<T>>
+        and sizeof(std::underlying_type_t<T>) > 1);
+
+  /**
+   * @brief Concept to check if a type is an optional value.
+   */
+  template <typename T>
+  concept IsOptional = IsSameAs<opt<typename T::value_type>, T>;
+
+  /**
+   * @brief Concept to check if a type is a view that is read in place from a serialized buffer.
+   */
+  template <typename T>
+  concept IsView = IsSameAs<std::basic_string_view<typename T::value_type>, T>
+                or IsSameAs<std::span<const typename T::value_type>, T>;
+
+  /**
+   * @brief Concept to check if a type has the interface of a tuple.
+   */
+  template <typename T>
+  concept IsTupleLike = requires { std::tuple_size<T>::value; };
+
+  /**
+   * @brief Concept to check if a type is a sequence of values that is serialized one by one.
+   */
+  template <typename T>
+  concept IsSequence = std::ranges::forward_range<T> and not IsTupleLike<T>;
+
+  /**
+   * @brief Concept to check if a type is a trivially copyable class without padding that is opted
+   *        into being serialized as its object representation.
+   */
+  template <typename T>
+  concept IsTrivial = std::is_class_v<T> and ObjectRepresentation<T>::IS_ENABLED
+                  and std::is_trivially_copyable_v<T>
+                  and std::has_unique_object_representations_v<T>;
+
+  /**
+   * @brief Concept to check if a type is a scalar or a class whose object representation can be
+   *        copied as is.
+   */
+  template <typename T>
+  concept IsDense = IsScalar<T> or IsTrivial<T>;
+
+  /**
+   * @brief Concept to check if a type is a resizable or viewed block of dense values that is
+   *        serialized with a single copy.
+   */
+  template <typename T>
+  concept IsBlock = std::ranges::contiguous_range<T> and std::ranges::sized_range<T>
+                and IsDense<std::ranges::range_value_t<T>> and not IsTupleLike<T>;
+
+  /**
+   * @brief The integer type that a scalar is stored as, i.e. the underlying type of enumerations.
+   */
+  template <typename T>
+  struct Underlying
+  {
+    using Type = T;
+  };
+
+  template <IsEnum T>
+  struct Underlying<T>
+  {
+    using Type = std::underlying_type_t<T>;
+  };
+
+  /**
+   * @brief The type of a value that a sequence element is read as, without constant keys.
+   */
+  template <typename T>
+  struct Element
+  {
+    using Type = T;
+  };
+
+  template <typename TFirst, typename TSecond>
+  struct Element<pair<const TFirst, TSecond>>
+  {
+    using Type = pair<TFirst, TSecond>;
+  };
+} // namespace fn::Serial::_internal
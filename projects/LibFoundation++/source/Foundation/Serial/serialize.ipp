@@ -0,0 +1,69 @@
+#pragma once
+
+#include "Foundation/Serial/Encoding.ipp"
+#include "Foundation/Serial/Reader.ipp"
+#include "Foundation/Serial/Writer.ipp"
+#include "Foundation/containers.hpp"
+#include "Foundation/errors.hpp"
+#include "Foundation/types.hpp"
+
+#include <span>
+#include <string>
+
+namespace fn::Serial
+{
+  /**
+   * @brief   Serializes a value into a new buffer.
+   * @param   value The value to serialize.
+   * @tparam  encoding The encoding of integers and lengths.
+   * @tparam  T The type of the value.
+   * @returns The serialized buffer.
+   * @see     `Writer` for the format.
+   */
+  template <Encoding encoding = Encoding::FIXED, typename T>
+  [[nodiscard]] auto serialize(const T& value) -> vec<byte>;
+
+  /**
+   * @brief   Deserializes a value that makes up a whole buffer.
+   * @param   bytes The serialized buffer.
+   * @tparam  T The type the value was serialized as, or a view type to read it in place.
+   * @tparam  encoding The encoding of integers and lengths.
+   * @returns The value.
+   * @throws  InputError If the buffer is malformed or holds bytes past the value.
+   * @see     `Reader` for views.
+   */
+  template <typename T, Encoding encoding = Encoding::FIXED>
+  [[nodiscard]] auto deserialize(std::span<const byte> bytes) -> T;
+} // namespace fn::Serial
+
+/*------------------------------------------------------------------------------------------------*\
+*| <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<< Implementation >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>> |*
+\*------------------------------------------------------------------------------------------------*/
+
+namespace fn::Serial
+{
+  template <Encoding encoding, typename T>
+  [[nodiscard]] auto serialize(const T& value) -> vec<byte>
+  {
+    Writer<encoding> writer;
+    writer.write(value);
+    return writer.release();
+  }
+
+  template <typename T, Encoding encoding>
+  [[nodiscard]] auto deserialize(const std::span<const byte> bytes) -> T
+  {
+    // Read the value
+    Reader<encoding> reader{bytes};
+    T                value{reader.template read<T>()};
+
+    // Throw error if bytes are left over
+    if (not reader.isExhausted())
+    {
+      throw InputError{"Trailing input!", std::to_string(reader.getOffset())};
+    }
+
+    // Return the value
+    return value;
+  }
+} // namespace fn::Serial
@@ -39,8 +39,10 @@ namespace fn::Support
 
 namespace fn::Support
 {
-#pragma warning(push)
-#pragma warning(disable : 26'467 26'472)
+#if defined(_MSC_VER)
+  #pragma warning(push)
+  #pragma warning(disable : 26'467 26'472)
+#endif
 
   template <IsArithmetic TTo, IsArithmetic TFrom>
   [[nodiscard]] constexpr auto narrow_cast(TFrom value) -> TTo
@@ -83,7 +85,9 @@ namespace fn::Support
     return castedValue;
   }
 
-#pragma warning(pop)
+#if defined(_MSC_VER)
+  #pragma warning(pop)
+#endif
 } // namespace fn::Support
 
 /*------------------------------------------------------------------------------------------------*\
@@ -0,0 +1,18 @@
+#pragma once
+
+#include "Foundation/concepts.hpp"
+
+#include "Foundation/types.hpp"
+
+namespace fn::Text::_internal
+{
+  /**
+   * @brief Concept to check if a type is a number that can be parsed from and formatted to text.
+   * @note  Only the integer and floating-point aliases are numbers; character types and
+   *        `fmax` are excluded.
+   */
+  template <typename T>
+  concept IsNumber = IsSameAs<T, i8> or IsSameAs<T, i16> or IsSameAs<T, i32> or IsSameAs<T, i64>
+                  or IsSameAs<T, u8> or IsSameAs<T, u16> or IsSameAs<T, u32> or IsSameAs<T, u64>
+                  or IsSameAs<T, f32> or IsSameAs<T, f64>;
+} // namespace fn::Text::_internal
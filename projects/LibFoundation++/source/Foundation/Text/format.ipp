@@ -0,0 +1,65 @@
+#pragma once
+
+#include "Foundation/Text/_internal/concepts.hpp"
+#include "Foundation/concepts.hpp"
+#include "Foundation/errors.hpp"
+#include "Foundation/types.hpp"
+
+#include <charconv>
+#include <limits>
+#include <span>
+#include <string>
+#include <system_error>
+
+namespace fn::Text
+{
+  /**
+   * @brief  The number of characters that is always sufficient to format a number of type `T`.
+   * @tparam T The type of the number.
+   * @remark Use it to size the buffers passed to `format`.
+   */
+  template <_internal::IsNumber T>
+  inline constexpr size FORMAT_CAPACITY{
+    IsIntegral<T> ? std::numeric_limits<T>::digits10 + 2 : std::numeric_limits<T>::max_digits10 + 8
+  };
+
+  /**
+   * @brief   Formats a number into a caller-provided buffer without locale lookups or allocations.
+   * @details Built on `std::to_chars`. Floating-point numbers are written in their shortest form
+   *          that parses back to the same value.
+   * @param   value The number to format.
+   * @param   buffer The buffer to write into, `FORMAT_CAPACITY<T>` characters always suffice.
+   * @tparam  T The type of the number.
+   * @returns A view of the written characters inside the buffer.
+   * @throws  ArgumentError If the buffer is too small.
+   */
+  template <_internal::IsNumber T>
+  [[nodiscard]] auto format(T value, std::span<cdef> buffer) -> strv;
+} // namespace fn::Text
+
+/*------------------------------------------------------------------------------------------------*\
+*| <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<< Implementation >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>> |*
+\*------------------------------------------------------------------------------------------------*/
+
+namespace fn::Text
+{
+  // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+  template <_internal::IsNumber T>
+  [[nodiscard]] auto format(const T value, const std::span<cdef> buffer) -> strv
+  {
+    // Format the value
+    const auto [end, error]{std::to_chars(buffer.data(), buffer.data() + buffer.size(), value)};
+
+    // Throw error if the buffer is too small
+    if (error != std::errc{})
+    {
+      throw ArgumentError{"Buffer too small!", std::to_string(buffer.size())};
+    }
+
+    // Return the written characters
+    return strv{buffer.data(), end};
+  }
+
+  // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+} // namespace fn::Text
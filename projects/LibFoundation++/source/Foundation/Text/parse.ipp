@@ -0,0 +1,88 @@
+#pragma once
+
+#include "Foundation/Text/_internal/concepts.hpp"
+#include "Foundation/constants.hpp"
+#include "Foundation/errors.hpp"
+#include "Foundation/types.hpp"
+#include "Foundation/utilities.hpp"
+
+#include <charconv>
+#include <system_error>
+
+namespace fn::Text
+{
+  /**
+   * @brief   Parses a number from text without locale lookups or allocations.
+   * @details Built on `std::from_chars`. The whole text must be consumed; leading whitespace, a
+   *          leading `+` and trailing characters are rejected. Floating-point numbers accept both
+   *          fixed and scientific notation.
+   * @param   text The text to parse.
+   * @tparam  T The type of the number.
+   * @returns The parsed number.
+   * @throws  InputError If the text is not a well-formed number.
+   * @throws  NarrowingError If the number cannot be represented by `T`.
+   */
+  template <_internal::IsNumber T>
+  [[nodiscard]] auto parse(strv text) -> T;
+
+  /**
+   * @brief   Parses a number from text without locale lookups, allocations or exceptions.
+   * @param   text The text to parse.
+   * @tparam  T The type of the number.
+   * @returns The parsed number, or `nopt` if the text is malformed or out of range.
+   * @see     `parse` for the accepted syntax.
+   */
+  template <_internal::IsNumber T>
+  [[nodiscard]] auto tryParse(strv text) noexcept -> opt<T>;
+} // namespace fn::Text
+
+/*------------------------------------------------------------------------------------------------*\
+*| <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<< Implementation >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>> |*
+\*------------------------------------------------------------------------------------------------*/
+
+namespace fn::Text
+{
+  // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+  template <_internal::IsNumber T>
+  [[nodiscard]] auto parse(const strv text) -> T
+  {
+    // Parse the text
+    T value{};
+    const auto [end, error]{std::from_chars(text.data(), text.data() + text.size(), value)};
+
+    // Throw error if the number does not fit the type
+    if (error == std::errc::result_out_of_range)
+    {
+      throw NarrowingError{"Value out of range!", str{text}};
+    }
+
+    // Throw error if the text is not a number or not fully consumed
+    if (error != std::errc{} or end != text.data() + text.size())
+    {
+      throw InputError{"Malformed number!", str{text}};
+    }
+
+    // Return the parsed value
+    return value;
+  }
+
+  template <_internal::IsNumber T>
+  [[nodiscard]] auto tryParse(const strv text) noexcept -> opt<T>
+  {
+    // Parse the text
+    T value{};
+    const auto [end, error]{std::from_chars(text.data(), text.data() + text.size(), value)};
+
+    // Return nothing if the text is malformed, out of range or not fully consumed
+    if (error != std::errc{} or end != text.data() + text.size())
+    {
+      return nopt;
+    }
+
+    // Return the parsed value
+    return value;
+  }
+
+  // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+} // namespace fn::Text
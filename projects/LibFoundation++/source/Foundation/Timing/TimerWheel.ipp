@@ -0,0 +1,499 @@
+#pragma once
+
+#include "Foundation/Timing/_internal/InlineCallback.ipp"
+#include "Foundation/concepts.hpp"
+#include "Foundation/containers.hpp"
+#include "Foundation/errors.hpp"
+#include "Foundation/types.hpp"
+
+#include <bit>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace fn::Timing
+{
+  /**
+   * @brief   A hierarchical hashed timing wheel that schedules, cancels and expires timers in
+   *          constant time.
+   * @details Time is an abstract tick count that only moves when `advance` is called, so the wheel
+   *          is deterministic and independent of any clock. Each of the `LEVEL_COUNT` levels hashes
+   *          one 6-bit digit of the deadline into `SLOT_COUNT` slots; a timer is kept on the level
+   *          of the highest digit in which its deadline differs from the current time. Advancing
+   *          jumps from one occupied slot to the next through an occupancy bitmap per level, so
+   *          empty stretches of time cost nothing. Timers of a higher level are moved to a lower
+   *          one when their slot is reached, which happens at most once per level. Timers live in
+   *          a slab of nodes that is reused through a free list, with their callbacks stored inline
+   *          in a parallel slab, so scheduling never allocates once the slabs have grown and moving
+   *          timers between slots only touches their compact nodes.
+   * @tparam  capacity The inline storage for the callback of each timer, in bytes.
+   */
+  template <size capacity = 48>
+  class TimerWheel final
+  {
+  public:
+    /*-----------------------------------------------------------------------------------+--------*\
+    *| [public]: Constants                                                               | PUBLIC |*
+    \*-----------------------------------------------------------------------------------+--------*/
+
+    /**
+     * @brief The number of slots per level.
+     */
+    static constexpr size SLOT_COUNT{64};
+
+    /**
+     * @brief The number of levels, enough to cover every 64-bit deadline.
+     */
+    static constexpr size LEVEL_COUNT{11};
+
+    /*-----------------------------------------------------------------------------------+--------*\
+    *| [public]: Types                                                                   | PUBLIC |*
+    \*-----------------------------------------------------------------------------------+--------*/
+
+    /**
+     * @brief A handle that identifies a scheduled timer, which remains safe to use after the timer
+     *        has expired or was cancelled.
+     */
+    struct Handle
+    {
+      u32 index{0};
+      u32 generation{0};
+    };
+
+    /*-----------------------------------------------------------------------------------+--------*\
+    *| [public]: Constructors                                                            | PUBLIC |*
+    \*-----------------------------------------------------------------------------------+--------*/
+
+    /**
+     * @brief Constructs an empty wheel.
+     * @param now The current time in ticks.
+     */
+    explicit TimerWheel(u64 now = 0) noexcept;
+
+    /*-----------------------------------------------------------------------------------+--------*\
+    *| [public]: Methods                                                                 | PUBLIC |*
+    \*-----------------------------------------------------------------------------------+--------*/
+
+    /**
+     * @brief   Schedules a callback to be invoked once the time reaches a deadline.
+     * @param   deadline The time in ticks at which the timer expires. Deadlines that are not after
+     *          the current time expire on the next advance.
+     * @param   callback The callback, which must fit the inline capacity.
+     * @tparam  TCallback The type of the callback.
+     * @returns The handle of the timer.
+     * @throws  StateError If the wheel already holds the maximum number of timers.
+     */
+    template <typename TCallback>
+      requires IsInvocableWith<std::decay_t<TCallback>&>
+    auto schedule(u64 deadline, TCallback&& callback) -> Handle;
+
+    /**
+     * @brief   Cancels a scheduled timer without invoking its callback.
+     * @param   handle The handle of the timer.
+     * @returns Whether the timer was still scheduled.
+     */
+    auto cancel(Handle handle) noexcept -> bln;
+
+    /**
+     * @brief   Advances the time and invokes the callbacks of every timer that expires.
+     * @details Callbacks are invoked in the order of their deadlines, with the time set to their
+     *          deadline, and may schedule or cancel timers. A timer scheduled by a callback with a
+     *          deadline up to `now` still expires in this advance, one at or before the current
+     *          time in the next advance. If a callback throws, the exception propagates and the
+     *          remaining expired timers are invoked by the next advance.
+     * @param   now The new time in ticks. Times before the current time only expire overdue timers.
+     * @returns The number of invoked callbacks.
+     */
+    auto advance(u64 now) -> size;
+
+    /**
+     * @brief Reserves space for a number of simultaneously scheduled timers.
+     * @param count The number of timers.
+     */
+    auto reserve(size count) -> none;
+
+    /*-----------------------------------------------------------------------------------+--------*\
+    *| [public]: Accessors                                                               | PUBLIC |*
+    \*-----------------------------------------------------------------------------------+--------*/
+
+    /**
+     * @brief   Accessor for whether a timer is still scheduled.
+     * @param   handle The handle of the timer.
+     * @returns Whether the timer has neither expired nor been cancelled.
+     */
+    [[nodiscard]] auto isScheduled(Handle handle) const noexcept -> bln;
+
+    /**
+     * @brief   Accessor for the current time.
+     * @returns The current time in ticks.
+     */
+    [[nodiscard]] auto getNow() const noexcept -> u64;
+
+    /**
+     * @brief   Accessor for the number of scheduled timers.
+     * @returns The number of timers that have neither expired nor been cancelled.
+     */
+    [[nodiscard]] auto getCount() const noexcept -> size;
+
+  private:
+    /*----------------------------------------------------------------------------------+---------*\
+    *| [private]: Constants                                                             | PRIVATE |*
+    \*----------------------------------------------------------------------------------+---------*/
+
+    static constexpr size SLOT_BITS{6};
+    static constexpr u32  NONE{~u32{0}};
+    static constexpr u16  OVERDUE{LEVEL_COUNT * SLOT_COUNT};
+    static constexpr u16  DUE{OVERDUE + 1};
+    static constexpr u16  FREE{DUE + 1};
+
+    /*----------------------------------------------------------------------------------+---------*\
+    *| [private]: Types                                                                 | PRIVATE |*
+    \*----------------------------------------------------------------------------------+---------*/
+
+    using Callback = _internal::InlineCallback<capacity>;
+
+    struct Node
+    {
+      u64 deadline{0};
+      u32 previous{NONE};
+      u32 next{NONE};
+      u32 generation{1};
+      u16 list{FREE};
+    };
+
+    struct List
+    {
+      u32 head{NONE};
+      u32 tail{NONE};
+    };
+
+    /*----------------------------------------------------------------------------------+---------*\
+    *| [private]: Methods                                                               | PRIVATE |*
+    \*----------------------------------------------------------------------------------+---------*/
+
+    [[nodiscard]] static auto getEpoch(u64 time, size level) noexcept -> u64;
+
+    [[nodiscard]] auto allocate() -> u32;
+    auto               release(u32 index) noexcept -> none;
+    auto               link(u32 index, u16 list) noexcept -> none;
+    auto               unlink(u32 index) noexcept -> none;
+    auto               place(u32 index) noexcept -> none;
+    auto               drain() -> size;
+
+    /*----------------------------------------------------------------------------------+---------*\
+    *| [private]: Fields                                                                | PRIVATE |*
+    \*----------------------------------------------------------------------------------+---------*/
+
+    vec<Node>             m_nodes;
+    vec<Callback>         m_callbacks;
+    arr<List, FREE>       m_lists{};
+    arr<u64, LEVEL_COUNT> m_occupied{};
+    u32                   m_free{NONE};
+    u64                   m_now;
+    size                  m_count{0};
+  };
+} // namespace fn::Timing
+
+/*------------------------------------------------------------------------------------------------*\
+*| <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<< Implementation >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>> |*
+\*------------------------------------------------------------------------------------------------*/
+
+namespace fn::Timing
+{
+  /*-------------------------------------------------------------------------------------+--------*\
+  *| [public]: Constructors                                                              | PUBLIC |*
+  \*-------------------------------------------------------------------------------------+--------*/
+
+  template <size capacity>
+  TimerWheel<capacity>::TimerWheel(const u64 now) noexcept
+    : m_now{now}
+  {}
+
+  /*-------------------------------------------------------------------------------------+--------*\
+  *| [public]: Methods                                                                   | PUBLIC |*
+  \*-------------------------------------------------------------------------------------+--------*/
+
+  template <size capacity>
+  template <typename TCallback>
+    requires IsInvocableWith<std::decay_t<TCallback>&>
+  auto TimerWheel<capacity>::schedule(const u64 deadline, TCallback&& callback) -> Handle
+  {
+    // Store the callback in a free node
+    Callback  stored{std::forward<TCallback>(callback)};
+    const u32 index{allocate()};
+    Node&     node{m_nodes[index]};
+    m_callbacks[index] = std::move(stored);
+    node.deadline      = deadline;
+
+    // Place the timer on the wheel, or keep it for the next advance if it is already due
+    if (deadline <= m_now)
+    {
+      link(index, OVERDUE);
+    }
+    else
+    {
+      place(index);
+    }
+    ++m_count;
+
+    // Return the handle of the timer
+    return {index, node.generation};
+  }
+
+  template <size capacity>
+  auto TimerWheel<capacity>::cancel(const Handle handle) noexcept -> bln
+  {
+    // Return false if the timer has already expired or been cancelled
+    if (not isScheduled(handle))
+    {
+      return false;
+    }
+
+    // Remove the timer from its slot and destroy its callback
+    unlink(handle.index);
+    m_callbacks[handle.index] = Callback{};
+    release(handle.index);
+    return true;
+  }
+
+  template <size capacity>
+  auto TimerWheel<capacity>::advance(const u64 now) -> size
+  {
+    // Expire the timers that were due before this advance
+    while (m_lists[OVERDUE].head != NONE)
+    {
+      const u32 index{m_lists[OVERDUE].head};
+      unlink(index);
+      link(index, DUE);
+    }
+    size count{drain()};
+
+    while (m_now < now)
+    {
+      // Find the occupied slot that starts first after the current time over all levels
+      u64  next{0};
+      size nextLevel{LEVEL_COUNT};
+      for (size level{0}; level < LEVEL_COUNT; ++level)
+      {
+        const u64 digit{(m_now >> (level * SLOT_BITS)) & (SLOT_COUNT - 1)};
+        const u64 later{digit == SLOT_COUNT - 1 ? 0 : m_occupied[level] & (~u64{0} << (digit + 1))};
+        if (later == 0)
+        {
+          continue;
+        }
+        const u64 offset{static_cast<u64>(std::countr_zero(later)) << (level * SLOT_BITS)};
+        const u64 start{getEpoch(m_now, level + 1) | offset};
+        if (nextLevel == LEVEL_COUNT or start < next)
+        {
+          next      = start;
+          nextLevel = level;
+        }
+      }
+
+      // Jump straight to the new time if no slot starts before it
+      if (nextLevel == LEVEL_COUNT or next > now)
+      {
+        m_now = now;
+        break;
+      }
+
+      // Move to the start of the slot, expiring its timers that are due and moving the others to
+      // lower levels
+      m_now = next;
+      const size digit{(next >> (nextLevel * SLOT_BITS)) & (SLOT_COUNT - 1)};
+      const auto slot{static_cast<u16>((nextLevel * SLOT_COUNT) + digit)};
+      u32 index{std::exchange(m_lists[slot], List{}).head};
+      m_occupied[nextLevel] &= ~(u64{1} << digit);
+      while (index != NONE)
+      {
+        const u32 successor{m_nodes[index].next};
+        if (m_nodes[index].deadline <= m_now)
+        {
+          link(index, DUE);
+        }
+        else
+        {
+          place(index);
+        }
+        index = successor;
+      }
+      count += drain();
+    }
+
+    // Return the number of invoked callbacks
+    return count;
+  }
+
+  template <size capacity>
+  auto TimerWheel<capacity>::reserve(const size count) -> none
+  {
+    m_nodes.reserve(count);
+    m_callbacks.reserve(count);
+  }
+
+  /*-------------------------------------------------------------------------------------+--------*\
+  *| [public]: Accessors                                                                 | PUBLIC |*
+  \*-------------------------------------------------------------------------------------+--------*/
+
+  template <size capacity>
+  [[nodiscard]] auto TimerWheel<capacity>::isScheduled(const Handle handle) const noexcept -> bln
+  {
+    return handle.index < m_nodes.size() and m_nodes[handle.index].generation == handle.generation
+       and m_nodes[handle.index].list != FREE;
+  }
+
+  template <size capacity>
+  [[nodiscard]] auto TimerWheel<capacity>::getNow() const noexcept -> u64
+  {
+    return m_now;
+  }
+
+  template <size capacity>
+  [[nodiscard]] auto TimerWheel<capacity>::getCount() const noexcept -> size
+  {
+    return m_count;
+  }
+
+  /*------------------------------------------------------------------------------------+---------*\
+  *| [private]: Methods                                                                 | PRIVATE |*
+  \*------------------------------------------------------------------------------------+---------*/
+
+  template <size capacity>
+  [[nodiscard]] auto TimerWheel<capacity>::getEpoch(const u64 time, const size level) noexcept
+    -> u64
+  {
+    // Clear the digits below the level, all of them past the highest level
+    const size shift{level * SLOT_BITS};
+    return shift >= 64 ? 0 : time >> shift << shift;
+  }
+
+  template <size capacity>
+  [[nodiscard]] auto TimerWheel<capacity>::allocate() -> u32
+  {
+    // Reuse a released node if possible
+    if (m_free != NONE)
+    {
+      const u32 index{m_free};
+      m_free = m_nodes[index].next;
+      return index;
+    }
+
+    // Throw error if the node indices are exhausted
+    if (m_nodes.size() == NONE)
+    {
+      throw StateError{"Too many timers!", std::to_string(m_nodes.size())};
+    }
+
+    // Grow both slabs before appending, so that a failed allocation leaves them the same size
+    const size count{m_nodes.size()};
+    if (count == m_nodes.capacity() or count == m_callbacks.capacity())
+    {
+      reserve(count == 0 ? 1 : 2 * count);
+    }
+
+    // Append a node and a callback, which cannot throw within the reserved capacity
+    m_nodes.emplace_back();
+    m_callbacks.emplace_back();
+    return static_cast<u32>(m_nodes.size() - 1);
+  }
+
+  template <size capacity>
+  auto TimerWheel<capacity>::release(const u32 index) noexcept -> none
+  {
+    // Invalidate the handles of the node, skipping the generation of default handles
+    Node& node{m_nodes[index]};
+    node.generation = node.generation == ~u32{0} ? 1 : node.generation + 1;
+    node.list       = FREE;
+
+    // Push the node onto the free list
+    node.next = m_free;
+    m_free    = index;
+    --m_count;
+  }
+
+  template <size capacity>
+  auto TimerWheel<capacity>::link(const u32 index, const u16 list) noexcept -> none
+  {
+    // Append the node to the list
+    Node& node{m_nodes[index]};
+    List& target{m_lists[list]};
+    node.list     = list;
+    node.previous = target.tail;
+    node.next     = NONE;
+    if (target.tail == NONE)
+    {
+      target.head = index;
+    }
+    else
+    {
+      m_nodes[target.tail].next = index;
+    }
+    target.tail = index;
+
+    // Mark the slot as occupied
+    if (list < OVERDUE)
+    {
+      m_occupied[list / SLOT_COUNT] |= u64{1} << (list % SLOT_COUNT);
+    }
+  }
+
+  template <size capacity>
+  auto TimerWheel<capacity>::unlink(const u32 index) noexcept -> none
+  {
+    // Remove the node from its list
+    const Node& node{m_nodes[index]};
+    List&       source{m_lists[node.list]};
+    (node.previous == NONE ? source.head : m_nodes[node.previous].next) = node.next;
+    (node.next == NONE ? source.tail : m_nodes[node.next].previous)     = node.previous;
+
+    // Mark the slot as empty if it was the last node
+    if (source.head == NONE and node.list < OVERDUE)
+    {
+      m_occupied[node.list / SLOT_COUNT] &= ~(u64{1} << (node.list % SLOT_COUNT));
+    }
+  }
+
+  template <size capacity>
+  auto TimerWheel<capacity>::place(const u32 index) noexcept -> none
+  {
+    // Hash the deadline by its highest digit that differs from the current time
+    const u64  deadline{m_nodes[index].deadline};
+    const auto level{static_cast<size>(std::bit_width(deadline ^ m_now) - 1) / SLOT_BITS};
+    const auto slot{static_cast<size>(deadline >> (level * SLOT_BITS)) & (SLOT_COUNT - 1)};
+    link(index, static_cast<u16>((level * SLOT_COUNT) + slot));
+  }
+
+  template <size capacity>
+  auto TimerWheel<capacity>::drain() -> size
+  {
+    // Release every due node before invoking its callback, so that callbacks can freely schedule
+    // and cancel timers and an exception leaves the remaining nodes due for the next advance
+    size count{0};
+    while (m_lists[DUE].head != NONE)
+    {
+      const u32 index{m_lists[DUE].head};
+      unlink(index);
+      Callback callback{std::move(m_callbacks[index])};
+      release(index);
+      callback();
+      ++count;
+    }
+
+    // Return the number of invoked callbacks
+    return count;
+  }
+} // namespace fn::Timing
+
+/*------------------------------------------------------------------------------------------------*\
+*| <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<< Promotes >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>> |*
+\*------------------------------------------------------------------------------------------------*/
+
+namespace fn
+{
+  /**
+   * @brief  A hierarchical hashed timing wheel with constant-time schedule, cancel and expiry.
+   * @tparam capacity The inline storage for the callback of each timer, in bytes. Defaults to 48.
+   */
+  template <size capacity = 48>
+  using timer_wheel = Timing::TimerWheel<capacity>;
+} // namespace fn
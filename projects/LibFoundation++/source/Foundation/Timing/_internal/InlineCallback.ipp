@@ -0,0 +1,221 @@
+#pragma once
+
+#include "Foundation/concepts.hpp"
+#include "Foundation/types.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace fn::Timing::_internal
+{
+  /**
+   * @brief   A move-only, type-erased callback without arguments that is stored inline.
+   * @details Callables that fit the capacity are constructed in place, so storing one never
+   *          allocates. Larger callables or callables that may throw when moved are rejected at
+   *          compile time.
+   * @tparam  capacity The size of the inline storage in bytes.
+   */
+  template <size capacity>
+  class InlineCallback final
+  {
+  public:
+    /*-----------------------------------------------------------------------------------+--------*\
+    *| [public]: Constructors                                                            | PUBLIC |*
+    \*-----------------------------------------------------------------------------------+--------*/
+
+    /**
+     * @brief Constructs an empty callback.
+     */
+    InlineCallback() noexcept = default;
+
+    /**
+     * @brief  Constructs a callback that stores a callable inline.
+     * @param  callable The callable to store.
+     * @tparam TCallable The type of the callable.
+     */
+    template <typename TCallable>
+      requires IsInvocableWith<std::decay_t<TCallable>&>
+           and IsNotSameAs<InlineCallback, std::decay_t<TCallable>>
+    explicit InlineCallback(TCallable&& callable);
+
+    /**
+     * @brief Callbacks are not copyable.
+     */
+    InlineCallback(const InlineCallback& other) = delete;
+
+    /**
+     * @brief Constructs a callback by moving the callable of another callback.
+     * @param other Other callback to move from, which is left empty.
+     */
+    InlineCallback(InlineCallback&& other) noexcept;
+
+    /*-----------------------------------------------------------------------------------+--------*\
+    *| [public]: Destructor                                                              | PUBLIC |*
+    \*-----------------------------------------------------------------------------------+--------*/
+
+    /**
+     * @brief Destructs the callback and its callable.
+     */
+    ~InlineCallback();
+
+    /*-----------------------------------------------------------------------------------+--------*\
+    *| [public]: Operators                                                               | PUBLIC |*
+    \*-----------------------------------------------------------------------------------+--------*/
+
+    /**
+     * @brief Callbacks are not copyable.
+     */
+    auto operator=(const InlineCallback& other) -> InlineCallback& = delete;
+
+    /**
+     * @brief   Assigns the callable of another callback to this callback by moving.
+     * @param   other The other callback to move from, which is left empty.
+     * @returns The reference to this callback.
+     */
+    auto operator=(InlineCallback&& other) noexcept -> InlineCallback&;
+
+    /**
+     * @brief Invokes the stored callable, which must exist.
+     */
+    auto operator()() -> none;
+
+  private:
+    /*----------------------------------------------------------------------------------+---------*\
+    *| [private]: Types                                                                 | PRIVATE |*
+    \*----------------------------------------------------------------------------------+---------*/
+
+    struct Operations
+    {
+      auto (*invoke)(none* storage) -> none;
+      auto (*relocate)(none* source, none* target) noexcept -> none;
+      auto (*destroy)(none* storage) noexcept -> none;
+    };
+
+    /*----------------------------------------------------------------------------------+---------*\
+    *| [private]: Constants                                                             | PRIVATE |*
+    \*----------------------------------------------------------------------------------+---------*/
+
+    template <typename TCallable>
+    static constexpr Operations OPERATIONS{
+      [](none* const storage) -> none
+      {
+        (*static_cast<TCallable*>(storage))();
+      },
+      [](none* const source, none* const target) noexcept -> none
+      {
+        ::new (target) TCallable{std::move(*static_cast<TCallable*>(source))};
+        std::destroy_at(static_cast<TCallable*>(source));
+      },
+      [](none* const storage) noexcept -> none
+      {
+        std::destroy_at(static_cast<TCallable*>(storage));
+      }
+    };
+
+    /*----------------------------------------------------------------------------------+---------*\
+    *| [private]: Methods                                                               | PRIVATE |*
+    \*----------------------------------------------------------------------------------+---------*/
+
+    auto reset() noexcept -> none;
+
+    /*----------------------------------------------------------------------------------+---------*\
+    *| [private]: Fields                                                                | PRIVATE |*
+    \*----------------------------------------------------------------------------------+---------*/
+
+    const Operations* m_operations{nullptr};
+    alignas(std::max_align_t) byte m_storage[capacity]; // NOLINT(*-avoid-c-arrays, *-member-init)
+  };
+} // namespace fn::Timing::_internal
+
+/*------------------------------------------------------------------------------------------------*\
+*| <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<< Implementation >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>> |*
+\*------------------------------------------------------------------------------------------------*/
+
+namespace fn::Timing::_internal
+{
+  /*-------------------------------------------------------------------------------------+--------*\
+  *| [public]: Constructors                                                              | PUBLIC |*
+  \*-------------------------------------------------------------------------------------+--------*/
+
+  template <size capacity>
+  template <typename TCallable>
+    requires IsInvocableWith<std::decay_t<TCallable>&>
+         and IsNotSameAs<InlineCallback<capacity>, std::decay_t<TCallable>>
+  InlineCallback<capacity>::InlineCallback(TCallable&& callable)
+  {
+    using Callable = std::decay_t<TCallable>;
+    static_assert(sizeof(Callable) <= capacity, "The callable exceeds the inline capacity!");
+    static_assert(alignof(Callable) <= alignof(std::max_align_t), "The callable is over-aligned!");
+    static_assert(
+      std::is_nothrow_move_constructible_v<Callable>, "The callable must be nothrow movable!"
+    );
+
+    // Construct the callable in place
+    ::new (static_cast<none*>(m_storage)) Callable{std::forward<TCallable>(callable)};
+    m_operations = &OPERATIONS<Callable>;
+  }
+
+  template <size capacity>
+  InlineCallback<capacity>::InlineCallback(InlineCallback&& other) noexcept
+    : m_operations{std::exchange(other.m_operations, nullptr)}
+  {
+    if (m_operations != nullptr)
+    {
+      m_operations->relocate(other.m_storage, m_storage);
+    }
+  }
+
+  /*-------------------------------------------------------------------------------------+--------*\
+  *| [public]: Destructor                                                                | PUBLIC |*
+  \*-------------------------------------------------------------------------------------+--------*/
+
+  template <size capacity>
+  InlineCallback<capacity>::~InlineCallback()
+  {
+    reset();
+  }
+
+  /*-------------------------------------------------------------------------------------+--------*\
+  *| [public]: Operators                                                                 | PUBLIC |*
+  \*-------------------------------------------------------------------------------------+--------*/
+
+  template <size capacity>
+  auto InlineCallback<capacity>::operator=(InlineCallback&& other) noexcept -> InlineCallback&
+  {
+    // Destroy the stored callable and relocate the other one
+    if (this != &other)
+    {
+      reset();
+      m_operations = std::exchange(other.m_operations, nullptr);
+      if (m_operations != nullptr)
+      {
+        m_operations->relocate(other.m_storage, m_storage);
+      }
+    }
+
+    // Return the reference to this callback
+    return *this;
+  }
+
+  template <size capacity>
+  auto InlineCallback<capacity>::operator()() -> none
+  {
+    m_operations->invoke(m_storage);
+  }
+
+  /*------------------------------------------------------------------------------------+---------*\
+  *| [private]: Methods                                                                 | PRIVATE |*
+  \*------------------------------------------------------------------------------------+---------*/
+
+  template <size capacity>
+  auto InlineCallback<capacity>::reset() noexcept -> none
+  {
+    if (m_operations != nullptr)
+    {
+      std::exchange(m_operations, nullptr)->destroy(m_storage);
+    }
+  }
+} // namespace fn::Timing::_internal
@@ -31,10 +31,12 @@ namespace fn::Utility
   auto elog(const T& message) noexcept -> none
   {
     // Ensure that the stream is in a non-throwing state
-    assert(std::cout.exceptions() == std::ios_base::iostate{0});
+    assert(std::cout.exceptions() == std::ios_base::goodbit);
 
-#pragma warning(push)
-#pragma warning(disable : 26'447)
+#if defined(_MSC_VER)
+  #pragma warning(push)
+  #pragma warning(disable : 26'447)
+#endif
 
     // NOLINTBEGIN(cppcoreguidelines-pro-bounds-array-to-pointer-decay, hicpp-no-array-decay)
 
@@ -43,7 +45,9 @@ namespace fn::Utility
 
     // NOLINTEND(cppcoreguidelines-pro-bounds-array-to-pointer-decay, hicpp-no-array-decay)
 
-#pragma warning(pop)
+#if defined(_MSC_VER)
+  #pragma warning(pop)
+#endif
   }
 
   // NOLINTEND(bugprone-exception-escape)
@@ -24,13 +24,17 @@ namespace fn::Utility
 {
   [[nodiscard]] inline auto what(const std::exception& exception) noexcept -> strv
   {
-#pragma warning(push)
-#pragma warning(disable : 26'447)
+#if defined(_MSC_VER)
+  #pragma warning(push)
+  #pragma warning(disable : 26'447)
+#endif
 
     // Return the exception message
     return exception.what();
 
-#pragma warning(pop)
+#if defined(_MSC_VER)
+  #pragma warning(pop)
+#endif
   }
 } // namespace fn::Utility
 
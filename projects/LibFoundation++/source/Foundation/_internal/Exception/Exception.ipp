@@ -2,6 +2,7 @@
 
 #include "Foundation/_internal/Exception/_internal/concepts.hpp"
 #include "Foundation/_internal/Exception/Name.ipp"
+#include "Foundation/_internal/Exception/StackTrace.ipp"
 #include "Foundation/concepts.hpp"
 #include "Foundation/types.hpp"
 #include "Foundation/utilities.hpp"
@@ -9,8 +10,35 @@
 #include <exception>
 #include <ostream>
 #include <source_location>
+#include <type_traits>
 #include <utility>
 
+namespace fn
+{
+  /**
+   * @brief   Whether exceptions of a type capture a stack trace on construction.
+   * @details Defaults to whether `FN_CAPTURE_STACK_TRACES` is defined. Specialize it to switch the
+   *          capture per exception type, e.g.
+   *          `template <> struct fn::StackTraceCapture<fn::StateError> { ... IS_ENABLED{true}; };`.
+   * @tparam  TException The exception type.
+   * @warning The specialization must precede the first instantiation of the exception type in
+   *          every translation unit, so declare it in a header that every user of the type
+   *          includes. Translation units that disagree on it violate the one definition rule.
+   */
+  template <typename TException>
+  struct StackTraceCapture
+  {
+    /**
+     * @brief Whether the stack trace is captured.
+     */
+#if defined(FN_CAPTURE_STACK_TRACES)
+    static constexpr bln IS_ENABLED{true};
+#else
+    static constexpr bln IS_ENABLED{false};
+#endif
+  };
+} // namespace fn
+
 namespace fn::_internal::Exception
 {
   /**
@@ -124,7 +152,37 @@ namespace fn::_internal::Exception
      */
     [[nodiscard]] auto getLocation() const noexcept -> const std::source_location&;
 
+    /**
+     * @brief   Accessor for the stack trace of the exception.
+     * @returns The stack trace captured on construction, symbolized only when printed.
+     */
+    [[nodiscard]] auto getStackTrace() const noexcept -> const StackTrace&
+    requires StackTraceCapture<Exception>::IS_ENABLED;
+
   private:
+    /*----------------------------------------------------------------------------------+---------*\
+    *| [private]: Constants                                                             | PRIVATE |*
+    \*----------------------------------------------------------------------------------+---------*/
+
+    static constexpr bln IS_STACK_TRACE_CAPTURED{StackTraceCapture<Exception>::IS_ENABLED};
+
+    /*----------------------------------------------------------------------------------+---------*\
+    *| [private]: Types                                                                 | PRIVATE |*
+    \*----------------------------------------------------------------------------------+---------*/
+
+    using StackTraceField = std::conditional_t<IS_STACK_TRACE_CAPTURED, StackTrace, unit>;
+
+    /*----------------------------------------------------------------------------------+---------*\
+    *| [private]: Methods                                                               | PRIVATE |*
+    \*----------------------------------------------------------------------------------+---------*/
+
+    /**
+     * @brief   Captures the stack trace if enabled for the exception type.
+     * @returns The captured stack trace, or nothing if disabled.
+     * @note    Forced inline like the constructors, so that the trace starts at the throw site.
+     */
+    [[nodiscard]] static auto captureStackTrace() noexcept -> StackTraceField;
+
     /*----------------------------------------------------------------------------------+---------*\
     *| [private]: Fields                                                                | PRIVATE |*
     \*----------------------------------------------------------------------------------+---------*/
@@ -132,6 +190,11 @@ namespace fn::_internal::Exception
     fn::opt<fn::str>     m_message;
     fn::opt<TContext>    m_context;
     std::source_location m_location;
+#if defined(_MSC_VER)
+    [[msvc::no_unique_address]] StackTraceField m_stackTrace;
+#else
+    [[no_unique_address]] StackTraceField m_stackTrace;
+#endif
 
     /*----------------------------------------------------------------------------------+---------*\
     *| [private]: Friends                                                               | PRIVATE |*
@@ -147,8 +210,10 @@ namespace fn::_internal::Exception
      */
     friend auto operator<<(std::ostream& os, const Exception& exception) noexcept -> std::ostream&
     {
-#pragma warning(push)
-#pragma warning(disable : 26'447 26'485)
+#if defined(_MSC_VER)
+  #pragma warning(push)
+  #pragma warning(disable : 26'447 26'485)
+#endif
 
       // NOLINTBEGIN(cppcoreguidelines-pro-bounds-array-to-pointer-decay, hicpp-no-array-decay)
 
@@ -180,7 +245,16 @@ namespace fn::_internal::Exception
       // Print routine
       os << "  Routine: " << exception.m_location.function_name();
 
-#pragma warning(pop)
+      // Print stack trace if captured
+      if constexpr (IS_STACK_TRACE_CAPTURED)
+      {
+        os << "\n  Stack:";
+        exception.m_stackTrace.print(os);
+      }
+
+#if defined(_MSC_VER)
+  #pragma warning(pop)
+#endif
 
       // Return output stream
       return os;
@@ -200,26 +274,37 @@ namespace fn::_internal::Exception
   *| [public]: Constructors                                                              | PUBLIC |*
   \*-------------------------------------------------------------------------------------+--------*/
 
+  // Inline the constructors into the throw site so that no frame precedes it in the stack trace
+#if defined(_MSC_VER)
+  #define FN_INLINE_FRAME __forceinline
+#else
+  #define FN_INLINE_FRAME [[gnu::always_inline]] inline
+#endif
+
   template <Name name, _internal::IsContext TContext>
-  Exception<name, TContext>::Exception(const std::source_location& location) noexcept
+  FN_INLINE_FRAME Exception<name, TContext>::Exception(const std::source_location& location
+  ) noexcept
     : m_location{location}
+    , m_stackTrace{captureStackTrace()}
   {}
 
   template <Name name, _internal::IsContext TContext>
-  Exception<name, TContext>::Exception(
+  FN_INLINE_FRAME Exception<name, TContext>::Exception(
     fn::str&& message, const std::source_location& location
   ) noexcept
     : m_message{std::move(message)}
     , m_location{location}
+    , m_stackTrace{captureStackTrace()}
   {}
 
   template <Name name, _internal::IsContext TContext>
-  Exception<name, TContext>::Exception(
+  FN_INLINE_FRAME Exception<name, TContext>::Exception(
     fn::str&& message, TContext&& context, const std::source_location& location
   ) noexcept
     : m_message{std::move(message)}
     , m_context{std::move(context)}
     , m_location{location}
+    , m_stackTrace{captureStackTrace()}
   {}
 
   /*-------------------------------------------------------------------------------------+--------*\
@@ -229,8 +314,10 @@ namespace fn::_internal::Exception
   template <Name name, _internal::IsContext TContext>
   [[nodiscard]] auto Exception<name, TContext>::what() const noexcept -> cstr
   {
-#pragma warning(push)
-#pragma warning(disable : 26'485)
+#if defined(_MSC_VER)
+  #pragma warning(push)
+  #pragma warning(disable : 26'485)
+#endif
 
     // NOLINTBEGIN(cppcoreguidelines-pro-bounds-array-to-pointer-decay, hicpp-no-array-decay)
 
@@ -238,7 +325,9 @@ namespace fn::_internal::Exception
 
     // NOLINTEND(cppcoreguidelines-pro-bounds-array-to-pointer-decay, hicpp-no-array-decay)
 
-#pragma warning(pop)
+#if defined(_MSC_VER)
+  #pragma warning(pop)
+#endif
   }
 
   /*-------------------------------------------------------------------------------------+--------*\
@@ -265,4 +354,32 @@ namespace fn::_internal::Exception
   {
     return m_location;
   }
+
+  template <Name name, _internal::IsContext TContext>
+  [[nodiscard]] auto Exception<name, TContext>::getStackTrace() const noexcept -> const StackTrace&
+  requires StackTraceCapture<Exception>::IS_ENABLED
+  {
+    return m_stackTrace;
+  }
+
+  /*------------------------------------------------------------------------------------+---------*\
+  *| [private]: Methods                                                                 | PRIVATE |*
+  \*------------------------------------------------------------------------------------+---------*/
+
+  template <Name name, _internal::IsContext TContext>
+  [[nodiscard]] FN_INLINE_FRAME auto Exception<name, TContext>::captureStackTrace() noexcept
+    -> StackTraceField
+  {
+    // Capture the raw return addresses if enabled, leaving symbolization to printing
+    if constexpr (IS_STACK_TRACE_CAPTURED)
+    {
+      return StackTrace::capture();
+    }
+    else
+    {
+      return {};
+    }
+  }
+
+#undef FN_INLINE_FRAME
 } // namespace fn::_internal::Exception
@@ -0,0 +1,273 @@
+#pragma once
+
+#include "Foundation/containers.hpp"
+#include "Foundation/types.hpp"
+#include "Foundation/utilities.hpp"
+
+#include <ios>
+#include <ostream>
+#include <span>
+
+#if defined(_MSC_VER)
+extern "C" __declspec(dllimport) auto __stdcall RtlCaptureStackBackTrace(
+  unsigned long  framesToSkip,
+  unsigned long  framesToCapture,
+  void**         backTrace,
+  unsigned long* backTraceHash
+) -> unsigned short;
+#else
+  #include <cxxabi.h>
+  #include <dlfcn.h>
+  #include <pthread.h>
+  #include <unwind.h>
+
+  #include <cstdlib>
+#endif
+
+namespace fn::_internal::Exception
+{
+  /**
+   * @brief   A stack trace of raw return addresses that is symbolized only when printed.
+   * @details Capturing copies at most `MAX_FRAMES` return addresses into an inline array without
+   *          allocating or resolving symbols. Printing resolves the symbol, offset and module of
+   *          each frame with `dladdr`, or prints the raw addresses where it is unavailable.
+   * @note    Define `FN_FRAME_POINTERS` and compile every translation unit with
+   *          `-fno-omit-frame-pointer` to capture by following the saved frame pointers, which
+   *          costs a few loads per frame; the CMake option `FN_FRAME_POINTERS` does both.
+   *          Otherwise, and on targets other than x86-64 and AArch64 Linux, capturing falls back to
+   *          the much slower table-driven unwinder. The walk stops at the first frame whose saved
+   *          frame pointer leaves the stack of the thread, e.g. in a library built without them.
+   * @note    Only symbols in the dynamic symbol table can be resolved; link with `-rdynamic` to
+   *          resolve the symbols of the executable, or resolve the printed module offsets offline.
+   */
+  class StackTrace final
+  {
+  public:
+    /*-----------------------------------------------------------------------------------+--------*\
+    *| [public]: Constants                                                               | PUBLIC |*
+    \*-----------------------------------------------------------------------------------+--------*/
+
+    /**
+     * @brief The maximum number of captured frames.
+     */
+    static constexpr size MAX_FRAMES{16};
+
+    /*-----------------------------------------------------------------------------------+--------*\
+    *| [public]: Methods                                                                 | PUBLIC |*
+    \*-----------------------------------------------------------------------------------+--------*/
+
+    /**
+     * @brief   Captures the return addresses of the calling thread.
+     * @param   skip The number of innermost frames to skip besides the frame of this function.
+     * @returns The captured stack trace.
+     */
+    [[nodiscard]] static auto capture(size skip = 0) noexcept -> StackTrace;
+
+    /**
+     * @brief Prints the stack trace, symbolizing every frame.
+     * @param os The output stream.
+     */
+    auto print(std::ostream& os) const -> none;
+
+    /*-----------------------------------------------------------------------------------+--------*\
+    *| [public]: Accessors                                                               | PUBLIC |*
+    \*-----------------------------------------------------------------------------------+--------*/
+
+    /**
+     * @brief   Accessor for the captured return addresses.
+     * @returns The return addresses from the innermost frame outwards.
+     */
+    [[nodiscard]] auto getFrames() const noexcept -> std::span<void* const>;
+
+  private:
+    /*----------------------------------------------------------------------------------+---------*\
+    *| [private]: Fields                                                                | PRIVATE |*
+    \*----------------------------------------------------------------------------------+---------*/
+
+    arr<void*, MAX_FRAMES> m_frames{};
+    size                   m_count{0};
+
+    /*----------------------------------------------------------------------------------+---------*\
+    *| [private]: Methods                                                               | PRIVATE |*
+    \*----------------------------------------------------------------------------------+---------*/
+
+#if not defined(_MSC_VER)
+    /**
+     * @brief   Accessor for the stack of the calling thread, queried once per thread.
+     * @returns The lowest and one past the highest address of the stack, equal if unknown.
+     */
+    [[nodiscard]] static auto getStackBounds() noexcept -> pair<uptr, uptr>;
+#endif
+  };
+} // namespace fn::_internal::Exception
+
+/*------------------------------------------------------------------------------------------------*\
+*| <<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<< Implementation >>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>>> |*
+\*------------------------------------------------------------------------------------------------*/
+
+namespace fn::_internal::Exception
+{
+  // NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast)
+  // NOLINTBEGIN(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+  /*-------------------------------------------------------------------------------------+--------*\
+  *| [public]: Methods                                                                   | PUBLIC |*
+  \*-------------------------------------------------------------------------------------+--------*/
+
+#if defined(_MSC_VER)
+  [[nodiscard]] __declspec(noinline) inline auto StackTrace::capture(const size skip) noexcept
+    -> StackTrace
+  {
+    // Walk the stack with the frame-based walker of the system
+    StackTrace trace;
+    trace.m_count = RtlCaptureStackBackTrace(
+      static_cast<unsigned long>(skip + 1), MAX_FRAMES, trace.m_frames.data(), nullptr
+    );
+    return trace;
+  }
+#else
+  [[nodiscard]] [[gnu::noinline]] inline auto StackTrace::capture(const size skip) noexcept
+    -> StackTrace
+  {
+    StackTrace trace;
+
+  #if defined(FN_FRAME_POINTERS) and defined(__linux__) \
+    and (defined(__x86_64__) or defined(__aarch64__))
+    // Follow the saved frame pointers, each next to the return address into the caller
+    if (const auto [low, high]{getStackBounds()}; low < high)
+    {
+      auto frame{reinterpret_cast<uptr>(__builtin_frame_address(0))};
+      size remaining{skip};
+      while (trace.m_count < MAX_FRAMES and frame >= low and frame <= high - 2 * sizeof(uptr)
+             and frame % sizeof(uptr) == 0)
+      {
+        const auto* const record{reinterpret_cast<const uptr*>(frame)};
+        if (record[1] == 0)
+        {
+          break;
+        }
+        if (remaining > 0)
+        {
+          --remaining;
+        }
+        else
+        {
+          trace.m_frames.at(trace.m_count++) = reinterpret_cast<void*>(record[1]);
+        }
+
+        // Stop unless the chain keeps growing towards the bottom of the stack
+        if (record[0] <= frame)
+        {
+          break;
+        }
+        frame = record[0];
+      }
+      return trace;
+    }
+  #endif
+
+    struct Walk
+    {
+      StackTrace& trace;
+      size        skip;
+    };
+
+    // Walk the stack with the unwinder, recording the instruction pointers only
+    Walk walk{trace, skip + 1};
+    _Unwind_Backtrace(
+      [](_Unwind_Context* const context, void* const state) -> _Unwind_Reason_Code
+      {
+        Walk& walk{*static_cast<Walk*>(state)};
+        if (walk.skip > 0)
+        {
+          --walk.skip;
+          return _URC_NO_REASON;
+        }
+        const uptr address{_Unwind_GetIP(context)};
+        if (address == 0 or walk.trace.m_count == MAX_FRAMES)
+        {
+          return _URC_END_OF_STACK;
+        }
+        walk.trace.m_frames.at(walk.trace.m_count++) = reinterpret_cast<void*>(address);
+        return _URC_NO_REASON;
+      },
+      &walk
+    );
+    return trace;
+  }
+#endif
+
+  inline auto StackTrace::print(std::ostream& os) const -> none
+  {
+    for (size index{0}; index < m_count; ++index)
+    {
+      void* const frame{m_frames.at(index)};
+      os << "\n    #" << index << ' ' << frame;
+
+#if not defined(_MSC_VER)
+      // Resolve the symbol of the call instruction, which precedes the return address
+      Dl_info info{};
+      if (dladdr(static_cast<const cdef*>(frame) - 1, &info) == 0)
+      {
+        continue;
+      }
+
+      // Print the demangled symbol and the offset into it if available
+      if (info.dli_sname != nullptr)
+      {
+        idef  status{0};
+        cdef* demangled{abi::__cxa_demangle(info.dli_sname, nullptr, nullptr, &status)};
+        os << ' ' << (status == 0 ? demangled : info.dli_sname) << "+0x" << std::hex
+           << (reinterpret_cast<uptr>(frame) - reinterpret_cast<uptr>(info.dli_saddr)) << std::dec;
+        std::free(demangled); // NOLINT(cppcoreguidelines-no-malloc, hicpp-no-malloc)
+      }
+
+      // Print the module and the offset into it, which offline tools can resolve
+      if (info.dli_fname != nullptr)
+      {
+        os << " (" << info.dli_fname << "+0x" << std::hex
+           << (reinterpret_cast<uptr>(frame) - reinterpret_cast<uptr>(info.dli_fbase)) << std::dec
+           << ')';
+      }
+#endif
+    }
+  }
+
+  /*-------------------------------------------------------------------------------------+--------*\
+  *| [public]: Accessors                                                                 | PUBLIC |*
+  \*-------------------------------------------------------------------------------------+--------*/
+
+  [[nodiscard]] inline auto StackTrace::getFrames() const noexcept -> std::span<void* const>
+  {
+    return {m_frames.data(), m_count};
+  }
+
+  /*------------------------------------------------------------------------------------+---------*\
+  *| [private]: Methods                                                                 | PRIVATE |*
+  \*------------------------------------------------------------------------------------+---------*/
+
+#if not defined(_MSC_VER)
+  [[nodiscard]] inline auto StackTrace::getStackBounds() noexcept -> pair<uptr, uptr>
+  {
+    // Query the stack once per thread, which reads the memory map of the process on the main thread
+    thread_local const pair<uptr, uptr> s_bounds{[]() -> pair<uptr, uptr>
+    {
+      pthread_attr_t attributes;
+      if (pthread_getattr_np(pthread_self(), &attributes) != 0)
+      {
+        return {0, 0};
+      }
+      void*      address{nullptr};
+      size       bytes{0};
+      const bln  isKnown{pthread_attr_getstack(&attributes, &address, &bytes) == 0};
+      pthread_attr_destroy(&attributes);
+      const uptr low{isKnown ? reinterpret_cast<uptr>(address) : 0};
+      return {low, isKnown ? low + bytes : 0};
+    }()};
+    return s_bounds;
+  }
+#endif
+
+  // NOLINTEND(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+  // NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast)
+} // namespace fn::_internal::Exception
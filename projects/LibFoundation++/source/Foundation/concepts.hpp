@@ -27,6 +27,20 @@ namespace fn
   template <typename T, typename... TArguments>
   concept IsConstructibleFrom = std::constructible_from<T, TArguments...>;
 
+  /**
+   * @brief  Concept that checks if a type is an enumeration.
+   * @remark "The type `IsEnum`."
+   */
+  template <typename T>
+  concept IsEnum = std::is_enum_v<T>;
+
+  /**
+   * @brief  Concept that checks if a type is integral.
+   * @remark "The type `IsIntegral`."
+   */
+  template <typename T>
+  concept IsIntegral = std::is_integral_v<T>;
+
   /**
    * @brief  Concept that checks if a callable is invocable with a set of arguments.
    * @remark "The callable `IsInvocableWith` the arguments."
@@ -96,6 +110,20 @@ namespace fn
   template <typename T, typename... TArguments>
   concept IsNotConstructibleFrom = not IsConstructibleFrom<T, TArguments...>;
 
+  /**
+   * @brief  Concept that checks if a type is not an enumeration.
+   * @remark "The type `IsNotEnum`."
+   */
+  template <typename T>
+  concept IsNotEnum = not IsEnum<T>;
+
+  /**
+   * @brief  Concept that checks if a type is not integral.
+   * @remark "The type `IsNotIntegral`."
+   */
+  template <typename T>
+  concept IsNotIntegral = not IsIntegral<T>;
+
   /**
    * @brief  Concept that checks if a callable is not invocable with a set of arguments.
    * @remark "The callable `IsNotInvocableWith` the arguments."
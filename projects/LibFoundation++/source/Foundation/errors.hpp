@@ -43,7 +43,8 @@ namespace fn
   /**
    * @brief   An exception type for errors related to narrowing conversions.
    * @details This exception is thrown by the `fn::narrow_cast` function when the cast produces a
-   *          result that cannot be accurately represented in the target type due to narrowing.
+   *          result that cannot be accurately represented in the target type due to narrowing, and
+   *          by the `fn::Text::parse` function when the parsed number does not fit the target type.
    * @warning Only use this exception in catch blocks as it is not meant to be thrown by the user.
    */
   using NarrowingError = EXCEPTION<NAME{"NarrowingError"}, str>;
@@ -12,10 +12,47 @@
 #include "Foundation/types.hpp"
 #include "Foundation/utilities.hpp"
 
+// fn::Algorithms headers
+#include "Foundation/Algorithms/sort.ipp"
+
+// fn::Coroutine headers
+#include "Foundation/Coroutine/Generator.ipp"
+#include "Foundation/Coroutine/Task.ipp"
+
+// fn::Enum headers
+#include "Foundation/Enum/Range.ipp"
+#include "Foundation/Enum/name.ipp"
+#include "Foundation/Enum/parse.ipp"
+
+// fn::Memory headers
+#include "Foundation/Memory/AllocationRegistry.ipp"
+#include "Foundation/Memory/AllocationStatistics.ipp"
+#include "Foundation/Memory/TrackingAllocator.ipp"
+
+// fn::Probabilistic headers
+#include "Foundation/Probabilistic/BloomFilter.ipp"
+#include "Foundation/Probabilistic/CuckooFilter.ipp"
+#include "Foundation/Probabilistic/Hash.ipp"
+#include "Foundation/Probabilistic/HyperLogLog.ipp"
+
+// fn::Serial headers
+#include "Foundation/Serial/Encoding.ipp"
+#include "Foundation/Serial/ObjectRepresentation.ipp"
+#include "Foundation/Serial/Reader.ipp"
+#include "Foundation/Serial/Writer.ipp"
+#include "Foundation/Serial/serialize.ipp"
+
 // fn::Support headers
 #include "Foundation/Support/consteval.ipp"
 #include "Foundation/Support/narrow.ipp"
 
+// fn::Text headers
+#include "Foundation/Text/format.ipp"
+#include "Foundation/Text/parse.ipp"
+
+// fn::Timing headers
+#include "Foundation/Timing/TimerWheel.ipp"
+
 // fn::Utility headers
 #include "Foundation/Utility/log.ipp"
 #include "Foundation/Utility/what.ipp"